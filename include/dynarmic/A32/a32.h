@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <dynarmic/A32/config.h>
 
@@ -97,6 +98,15 @@ public:
      */
     std::string Disassemble(const IR::LocationDescriptor& descriptor);
 
+    /**
+     * Debugging: Compilation statistics for each step of the optimization pipeline, in pipeline order.
+     * Statistics are only recorded if UserConfig::record_pass_statistics is set.
+     */
+    std::vector<PassStatistics> GetPassStatistics() const;
+
+    /// Resets all compilation statistics to zero.
+    void ResetPassStatistics();
+
 private:
     bool is_executing = false;
 
@@ -9,6 +9,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
+
+#include <dynarmic/optimization.h>
 
 namespace Dynarmic {
 namespace A32 {
@@ -49,6 +52,11 @@ struct UserCallbacks {
     // Memory must be interpreted as little endian.
     virtual std::uint32_t MemoryReadCode(VAddr vaddr) { return MemoryRead32(vaddr); }
 
+    // Optionally returns a host pointer to the start of the 4KiB page containing vaddr, from which
+    // instructions are read directly during translation instead of through MemoryReadCode.
+    // Returning nullptr falls back to MemoryReadCode for that page.
+    virtual const std::uint8_t* MemoryReadCodePage(VAddr /* vaddr */) { return nullptr; }
+
     // Reads through these callbacks may not be aligned.
     // Memory must be interpreted as if ENDIANSTATE == 0, endianness will be corrected by the JIT.
     virtual std::uint8_t MemoryRead8(VAddr vaddr) = 0;
@@ -62,6 +70,20 @@ struct UserCallbacks {
     virtual void MemoryWrite32(VAddr vaddr, std::uint32_t value) = 0;
     virtual void MemoryWrite64(VAddr vaddr, std::uint64_t value) = 0;
 
+    // Bulk accessors used in place of runs of contiguous MemoryRead*/MemoryWrite* calls if
+    // UserConfig::enable_memory_block_callbacks is true. length is at most 64 bytes.
+    // The default implementations access memory one byte at a time.
+    virtual void MemoryReadBlock(VAddr vaddr, void* buffer, std::size_t length) {
+        for (std::size_t i = 0; i < length; i++) {
+            static_cast<std::uint8_t*>(buffer)[i] = MemoryRead8(static_cast<VAddr>(vaddr + i));
+        }
+    }
+    virtual void MemoryWriteBlock(VAddr vaddr, const void* buffer, std::size_t length) {
+        for (std::size_t i = 0; i < length; i++) {
+            MemoryWrite8(static_cast<VAddr>(vaddr + i), static_cast<const std::uint8_t*>(buffer)[i]);
+        }
+    }
+
     // If this callback returns true, the JIT will assume MemoryRead* callbacks will always
     // return the same value at any point in time for this vaddr. The JIT may use this information
     // in optimizations.
@@ -94,6 +116,21 @@ struct UserConfig {
     /// This is intended to be used for debugging.
     bool enable_optimizations = true;
 
+    /// Selects the IR optimization pipeline. Only used if enable_optimizations is true.
+    OptimizationLevel optimization_level = OptimizationLevel::Full;
+    /// If non-empty, this explicit sequence of passes is used instead of the pipeline
+    /// selected by optimization_level. Passes may be repeated.
+    std::vector<OptimizationPass> optimization_passes{};
+    /// When set to true, wall time and IR instruction counts are recorded for each step of
+    /// the optimization pipeline. These can be retrieved with Jit::GetPassStatistics.
+    bool record_pass_statistics = false;
+
+    /// When set to true, contiguous memory accesses with no intervening side-effects (such as
+    /// those performed by a single LDM, STM, VLDM or VSTM instruction) are combined into a
+    /// single call to UserCallbacks::MemoryReadBlock or UserCallbacks::MemoryWriteBlock.
+    /// This is only used if page_table is nullptr.
+    bool enable_memory_block_callbacks = false;
+
     // Page Table
     // The page table is used for faster memory access. If an entry in the table is nullptr,
     // the JIT will fallback to calling the MemoryRead*/MemoryWrite* callbacks.
@@ -107,6 +144,15 @@ struct UserConfig {
     ///       So there might be wrongly faulted pages which maps to nullptr.
     ///       This can be avoided by carefully allocating the memory region.
     bool absolute_offset_page_table = false;
+    /// If true, the low two bits of each page_table entry are attribute flags rather than
+    /// part of the host page pointer, which must then be at least 4-byte aligned.
+    /// Writes to a page with any attribute flag set go through the MemoryWrite* callbacks,
+    /// while reads of it stay on the fast path. The JIT treats both flags identically; they
+    /// exist so that embedders can tell write-protected pages from write-watched ones.
+    static constexpr std::uintptr_t PAGE_ATTRIBUTE_READ_ONLY = 1 << 0;
+    static constexpr std::uintptr_t PAGE_ATTRIBUTE_WRITE_CALLBACK = 1 << 1;
+    static constexpr std::uintptr_t PAGE_ATTRIBUTE_MASK = PAGE_ATTRIBUTE_READ_ONLY | PAGE_ATTRIBUTE_WRITE_CALLBACK;
+    bool page_table_attribute_bits = false;
 
     // Fastmem Pointer
     // This should point to the beginning of a 4GB address space which is in arranged just like
@@ -116,6 +162,12 @@ struct UserConfig {
     /// Determines if instructions that pagefault should cause recompilation of that block
     /// with fastmem disabled.
     bool recompile_on_fastmem_failure = true;
+    /// Only used by the AArch64 host backend, and only when fastmem_pointer is set.
+    /// When true, LDREX records the value it observed and STREX commits with a host
+    /// LDAXR/STLXR compare-and-swap on the fastmem mapping, so that exclusive pairs are
+    /// atomic with respect to other Jit instances sharing the same memory. Accesses that
+    /// fault fall back to the MemoryRead*/MemoryWrite* callbacks.
+    bool fastmem_exclusive_access = false;
 
     // Coprocessors
     std::array<std::shared_ptr<Coprocessor>, 16> coprocessors{};
@@ -132,6 +184,14 @@ struct UserConfig {
     /// This enables the fast dispatcher.
     bool enable_fast_dispatch = true;
 
+    /// Only used by the AArch64 host backend.
+    /// When true, R0-R4, SP and LR live in callee-saved host registers for the duration
+    /// of Jit::Run instead of in the guest state. They are written back before returning
+    /// to the host and around the CallSVC, ExceptionRaised, InterpreterFallback and
+    /// coprocessor callbacks. They are NOT written back around the Memory* callbacks, so
+    /// those callbacks must not inspect or modify guest registers.
+    bool pin_guest_registers = false;
+
     /// This option relates to the CPSR.E flag. Enabling this option disables modification
     /// of CPSR.E by the emulated program, forcing it to 0.
     /// NOTE: Calling Jit::SetCpsr with CPSR.E=1 while this option is enabled may result
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <dynarmic/A64/config.h>
 
@@ -48,6 +49,20 @@ public:
      */
     void InvalidateCacheRange(std::uint64_t start_address, std::size_t length);
 
+    /**
+     * Invalidates all entries of the software TLB (see UserConfig::enable_software_tlb).
+     * Can be called at any time, including from within a callback.
+     */
+    void InvalidateTlb();
+
+    /**
+     * Invalidates the entries of the software TLB that translate a range of addresses.
+     * Can be called at any time, including from within a callback.
+     * @param start_address The starting address of the range to invalidate.
+     * @param length The length (in bytes) of the range to invalidate.
+     */
+    void InvalidateTlbRange(std::uint64_t start_address, std::size_t length);
+
     /**
      * Reset CPU state to state at startup. Does not clear code cache.
      * Cannot be called from a callback.
@@ -128,6 +143,15 @@ public:
      */
     std::string Disassemble() const;
 
+    /**
+     * Debugging: Compilation statistics for each step of the optimization pipeline, in pipeline order.
+     * Statistics are only recorded if UserConfig::record_pass_statistics is set.
+     */
+    std::vector<PassStatistics> GetPassStatistics() const;
+
+    /// Resets all compilation statistics to zero.
+    void ResetPassStatistics();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl;
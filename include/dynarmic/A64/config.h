@@ -9,6 +9,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
+
+#include <dynarmic/optimization.h>
 
 namespace Dynarmic {
 namespace A64 {
@@ -69,6 +72,11 @@ struct UserCallbacks {
     // Memory must be interpreted as little endian.
     virtual std::uint32_t MemoryReadCode(VAddr vaddr) { return MemoryRead32(vaddr); }
 
+    // Optionally returns a host pointer to the start of the 4KiB page containing vaddr, from which
+    // instructions are read directly during translation instead of through MemoryReadCode.
+    // Returning nullptr falls back to MemoryReadCode for that page.
+    virtual const std::uint8_t* MemoryReadCodePage(VAddr /* vaddr */) { return nullptr; }
+
     // Reads through these callbacks may not be aligned.
     virtual std::uint8_t MemoryRead8(VAddr vaddr) = 0;
     virtual std::uint16_t MemoryRead16(VAddr vaddr) = 0;
@@ -83,6 +91,20 @@ struct UserCallbacks {
     virtual void MemoryWrite64(VAddr vaddr, std::uint64_t value) = 0;
     virtual void MemoryWrite128(VAddr vaddr, Vector value) = 0;
 
+    // Bulk accessors used in place of runs of contiguous MemoryRead*/MemoryWrite* calls if
+    // UserConfig::enable_memory_block_callbacks is true. length is at most 64 bytes.
+    // The default implementations access memory one byte at a time.
+    virtual void MemoryReadBlock(VAddr vaddr, void* buffer, std::size_t length) {
+        for (std::size_t i = 0; i < length; i++) {
+            static_cast<std::uint8_t*>(buffer)[i] = MemoryRead8(static_cast<VAddr>(vaddr + i));
+        }
+    }
+    virtual void MemoryWriteBlock(VAddr vaddr, const void* buffer, std::size_t length) {
+        for (std::size_t i = 0; i < length; i++) {
+            MemoryWrite8(static_cast<VAddr>(vaddr + i), static_cast<const std::uint8_t*>(buffer)[i]);
+        }
+    }
+
     // Writes through these callbacks may not be aligned.
     virtual bool MemoryWriteExclusive8(VAddr vaddr, std::uint8_t value, std::uint8_t expected) = 0;
     virtual bool MemoryWriteExclusive16(VAddr vaddr, std::uint16_t value, std::uint16_t expected) = 0;
@@ -96,6 +118,11 @@ struct UserCallbacks {
     // A conservative implementation that always returns false is safe.
     virtual bool IsReadOnlyMemory(VAddr /* vaddr */) { return false; }
 
+    // Used to refill the software TLB (see UserConfig::enable_software_tlb) when page_table is nullptr.
+    // Returns a host pointer to the start of the 4KiB page containing vaddr, or nullptr if accesses to
+    // that page must go through the MemoryRead*/MemoryWrite* callbacks (e.g.: MMIO or unmapped memory).
+    virtual std::uint8_t* TranslateAddress(VAddr /* vaddr */) { return nullptr; }
+
     /// The interpreter must execute exactly num_instructions starting from PC.
     virtual void InterpreterFallback(VAddr pc, size_t num_instructions) = 0;
 
@@ -130,6 +157,15 @@ struct UserConfig {
     /// This is intended to be used for debugging.
     bool enable_optimizations = true;
 
+    /// Selects the IR optimization pipeline. Only used if enable_optimizations is true.
+    OptimizationLevel optimization_level = OptimizationLevel::Full;
+    /// If non-empty, this explicit sequence of passes is used instead of the pipeline
+    /// selected by optimization_level. Passes may be repeated.
+    std::vector<OptimizationPass> optimization_passes{};
+    /// When set to true, wall time and IR instruction counts are recorded for each step of
+    /// the optimization pipeline. These can be retrieved with Jit::GetPassStatistics.
+    bool record_pass_statistics = false;
+
     /// When set to true, UserCallbacks::DataCacheOperationRaised will be called when any
     /// data cache instruction is executed. Notably DC ZVA will not implicitly do anything.
     /// When set to false, UserCallbacks::DataCacheOperationRaised will never be called.
@@ -163,6 +199,12 @@ struct UserConfig {
     /// emitted code.
     const std::uint64_t* tpidr_el0 = nullptr;
 
+    /// When set to true, contiguous memory accesses with no intervening side-effects (such as
+    /// those performed by a single LDP, STP, LD1 or ST1 instruction) are combined into a
+    /// single call to UserCallbacks::MemoryReadBlock or UserCallbacks::MemoryWriteBlock.
+    /// This is only used if page_table is nullptr and enable_software_tlb is false.
+    bool enable_memory_block_callbacks = false;
+
     /// Pointer to the page table which we can use for direct page table access.
     /// If an entry in page_table is null, the relevant memory callback will be called.
     /// If page_table is nullptr, all memory accesses hit the memory callbacks.
@@ -177,6 +219,19 @@ struct UserConfig {
     /// relevant memory callback.
     /// This is only used if page_table is not nullptr.
     bool silently_mirror_page_table = true;
+    /// Number of levels in page_table. Valid values are between 1 and 4 inclusive.
+    /// With a single level, page_table is a flat array of host page pointers indexed by
+    /// (vaddr >> 12), which requires 2^(page_table_address_space_bits - 9) bytes.
+    /// With more than one level, page_table is a radix tree: each entry of a non-final level
+    /// points to a table of the next level, and entries of the final level are host page
+    /// pointers. Any null entry results in a call to the relevant memory callback.
+    /// The page index bits (vaddr >> 12) are split between levels as follows: all levels
+    /// other than the first index floor((page_table_address_space_bits - 12) / levels) bits
+    /// each, and the first level indexes the remaining top bits.
+    /// e.g.: 39 address space bits and 3 levels gives a 9/9/9 split, 48 gives 12/12/12,
+    /// and 39 address space bits with 2 levels gives a 14/13 split.
+    /// This is only used if page_table is not nullptr.
+    size_t page_table_levels = 1;
     /// Determines if the pointer in the page_table shall be offseted locally or globally.
     /// 'false' will access page_table[addr >> bits][addr & mask]
     /// 'true'  will access page_table[addr >> bits][addr]
@@ -184,6 +239,16 @@ struct UserConfig {
     ///       So there might be wrongly faulted pages which maps to nullptr.
     ///       This can be avoided by carefully allocating the memory region.
     bool absolute_offset_page_table = false;
+    /// If true, the low two bits of each page_table entry are attribute flags rather than
+    /// part of the host page pointer, which must then be at least 4-byte aligned.
+    /// Writes to a page with any attribute flag set go through the MemoryWrite* callbacks,
+    /// while reads of it stay on the fast path. The JIT treats both flags identically; they
+    /// exist so that embedders can tell write-protected pages from write-watched ones.
+    static constexpr std::uintptr_t PAGE_ATTRIBUTE_READ_ONLY = 1 << 0;
+    static constexpr std::uintptr_t PAGE_ATTRIBUTE_WRITE_CALLBACK = 1 << 1;
+    static constexpr std::uintptr_t PAGE_ATTRIBUTE_MASK = PAGE_ATTRIBUTE_READ_ONLY | PAGE_ATTRIBUTE_WRITE_CALLBACK;
+    /// This is only used if page_table is not nullptr.
+    bool page_table_attribute_bits = false;
     /// Determines if we should detect memory accesses via page_table that straddle are
     /// misaligned. Accesses that straddle page boundaries will fallback to the relevant
     /// memory callback.
@@ -194,6 +259,13 @@ struct UserConfig {
     /// page boundary.
     bool only_detect_misalignment_via_page_table_on_page_boundary = false;
 
+    /// Enables a small direct-mapped software TLB of host page pointers that emitted code
+    /// probes before falling back to the memory callbacks. On a TLB miss the entry is refilled
+    /// by walking page_table if it is not nullptr, or by calling UserCallbacks::TranslateAddress
+    /// otherwise. Accesses that straddle a page boundary always go through the memory callbacks.
+    /// The TLB must be invalidated with Jit::InvalidateTlb or Jit::InvalidateTlbRange whenever
+    /// a previously translated mapping changes.
+    bool enable_software_tlb = false;
 
     /// This option relates to translation. Generally when we run into an unpredictable
     /// instruction the ExceptionRaised callback is called. If this is true, we define
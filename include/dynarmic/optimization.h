@@ -0,0 +1,72 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Dynarmic {
+
+/// IR optimization passes that can be scheduled in an optimization pipeline.
+/// A pass that is not applicable to the current frontend or host backend is skipped.
+enum class OptimizationPass {
+    /// Removes redundant reads and writes of guest registers and flags.
+    GetSetElimination,
+    /// Replaces reads from read-only guest memory with constants.
+    ConstantMemoryReads,
+    /// Folds operations on constant operands.
+    ConstantPropagation,
+    /// Pattern-based rewrites and instruction fusion.
+    Peephole,
+    /// Removes instructions whose results are unused and that have no side-effects.
+    DeadCodeElimination,
+    /// Merges consecutive interpreter fallbacks into a single callback.
+    MergeInterpretBlocks,
+    /// Constant propagation, identity removal and dead code elimination in a single sweep.
+    Simplification,
+    /// Merges adjacent guest memory accesses from the same base address into wider accesses.
+    /// This pass is skipped unless guest memory is backed by a page table, fastmem or the software TLB,
+    /// so that embedders relying solely on the memory callbacks see the accesses the guest made.
+    MemoryCoalescing,
+    /// Forwards values written to guest memory to later reads of the same address, and removes
+    /// repeated reads of an address. Assumes guest memory has no read side-effects, so this pass is
+    /// not part of any OptimizationLevel and only runs when listed in optimization_passes.
+    /// It is skipped unless guest memory is backed by a page table, fastmem or the software TLB,
+    /// in which case the pages that are still routed to the memory callbacks must not be memory-mapped I/O.
+    /// Writes are not forwarded when page table attribute bits are in use, as such writes may be
+    /// intercepted by the memory callbacks.
+    RedundantLoadElimination,
+};
+
+constexpr std::size_t OptimizationPassCount = static_cast<std::size_t>(OptimizationPass::RedundantLoadElimination) + 1;
+
+/// Predefined optimization pipelines.
+enum class OptimizationLevel {
+    /// No IR optimizations are performed.
+    None,
+    /// Only redundant guest state accesses are removed. Cheapest to compile.
+    Fast,
+    /// All passes are performed, except for RedundantLoadElimination which has to be requested explicitly.
+    Full,
+};
+
+/// Compilation statistics for a single step of the optimization pipeline.
+/// A pass that is scheduled multiple times has one entry per occurrence.
+struct PassStatistics {
+    OptimizationPass pass;
+    /// Human-readable name of the pass.
+    const char* name;
+    /// Number of blocks this pass has been run on.
+    std::uint64_t invocations = 0;
+    /// Total wall time spent in this pass, in nanoseconds.
+    std::uint64_t total_time_ns = 0;
+    /// Total number of IR instructions in blocks before this pass was run.
+    std::uint64_t instructions_before = 0;
+    /// Total number of IR instructions in blocks after this pass was run.
+    std::uint64_t instructions_after = 0;
+};
+
+} // namespace Dynarmic
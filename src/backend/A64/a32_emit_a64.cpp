@@ -4,6 +4,7 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
 #include <iterator>
 #include <unordered_map>
 #include <unordered_set>
@@ -55,6 +56,26 @@ static size_t MJitStateExtReg(A32::ExtReg reg) {
     ASSERT_FALSE("Should never happen.");
 }
 
+// Guest registers kept in host registers when UserConfig::pin_guest_registers is set.
+// These are callee-saved so that they survive calls into the dispatcher and memory callbacks.
+static constexpr std::array<std::pair<A32::Reg, ARM64Reg>, 7> pinned_register_map{{
+    {A32::Reg::R0, W19}, {A32::Reg::R1, W20}, {A32::Reg::R2, W21}, {A32::Reg::R3, W22},
+    {A32::Reg::R4, W23}, {A32::Reg::SP, W24}, {A32::Reg::LR, W25},
+}};
+
+static std::vector<HostLoc> GprOrder(const A32::UserConfig& config) {
+    std::vector<HostLoc> gpr_order;
+    for (HostLoc loc : any_gpr) {
+        const bool is_pinned = config.pin_guest_registers && std::any_of(pinned_register_map.begin(), pinned_register_map.end(), [loc](const auto& pinned) {
+            return DecodeReg(HostLocToReg64(loc)) == pinned.second;
+        });
+        if (!is_pinned) {
+            gpr_order.push_back(loc);
+        }
+    }
+    return gpr_order;
+}
+
 A32EmitContext::A32EmitContext(RegAlloc& reg_alloc, IR::Block& block) : EmitContext(reg_alloc, block) {}
 
 A32::LocationDescriptor A32EmitContext::Location() const {
@@ -86,7 +107,7 @@ std::ptrdiff_t A32EmitContext::GetInstOffset(IR::Inst* inst) const {
 }
 
 A32EmitA64::A32EmitA64(BlockOfCode& code, A32::UserConfig config, A32::Jit* jit_interface)
-    : EmitA64(code), config(std::move(config)), jit_interface(jit_interface) {
+    : EmitA64(code), config(std::move(config)), jit_interface(jit_interface), gpr_order(GprOrder(this->config)) {
     exception_handler.Register(code, [this](CodePtr PC){FastmemCallback(PC);});
     GenMemoryAccessors();
     GenTerminalHandlers();
@@ -97,23 +118,49 @@ A32EmitA64::A32EmitA64(BlockOfCode& code, A32::UserConfig config, A32::Jit* jit_
 
 A32EmitA64::~A32EmitA64() = default;
 
+std::vector<PinnedRegister> A32EmitA64::PinnedRegisters(const A32::UserConfig& config) {
+    std::vector<PinnedRegister> pinned_registers;
+    if (config.pin_guest_registers) {
+        for (const auto& [guest_reg, host_reg] : pinned_register_map) {
+            pinned_registers.push_back({host_reg, MJitStateReg(guest_reg)});
+        }
+    }
+    return pinned_registers;
+}
+
+std::optional<ARM64Reg> A32EmitA64::PinnedHostReg(A32::Reg reg) const {
+    if (!config.pin_guest_registers) {
+        return std::nullopt;
+    }
+    for (const auto& [guest_reg, host_reg] : pinned_register_map) {
+        if (guest_reg == reg) {
+            return host_reg;
+        }
+    }
+    return std::nullopt;
+}
+
 A32EmitA64::BlockDescriptor A32EmitA64::Emit(IR::Block& block) {
     code.EnableWriting();
     SCOPE_EXIT {
         code.DisableWriting();
     };
 
-    RegAlloc reg_alloc{code, A32JitState::SpillCount, SpillToOpArg<A32JitState>};
+    RegAlloc reg_alloc{code, A32JitState::SpillCount, SpillToOpArg<A32JitState>, gpr_order};
     A32EmitContext ctx{reg_alloc, block};    
 
     const u8* entrypoint = code.AlignCode16();
 
     // Start emitting.
-    EmitCondPrelude(ctx);
+    const CodePtr nzcv_live_entrypoint = EmitCondPrelude(ctx);
 
     for (auto iter = block.begin(); iter != block.end(); ++iter) {
         IR::Inst* inst = &*iter;
 
+        // The emitter erases this pseudo-operation, so look it up beforehand.
+        const bool may_set_host_nzcv = inst->GetOpcode() == IR::Opcode::Add32 || inst->GetOpcode() == IR::Opcode::Sub32;
+        const IR::Inst* nzcv_from_op = may_set_host_nzcv ? inst->GetAssociatedPseudoOperation(IR::Opcode::GetNZCVFromOp) : nullptr;
+
         // Call the relevant Emit* member function.
         switch (inst->GetOpcode()) {
 
@@ -136,13 +183,16 @@ A32EmitA64::BlockDescriptor A32EmitA64::Emit(IR::Block& block) {
             break;
         }
 
+        UpdateHostNZCV(ctx, inst, nzcv_from_op);
         reg_alloc.EndOfAllocScope();
     }
 
     reg_alloc.AssertNoMoreUses();
 
     EmitAddCycles(block.CycleCount());
+    nzcv_live_at_terminal = ctx.nzcv_in_host;
     EmitA64::EmitTerminal(block.GetTerminal(), ctx.Location().SetSingleStepping(false), ctx.IsSingleStep());
+    nzcv_live_at_terminal = false;
     code.BRK(0);
     code.PatchConstPool();
     code.FlushIcacheSection(entrypoint, code.GetCodePtr());
@@ -155,6 +205,12 @@ A32EmitA64::BlockDescriptor A32EmitA64::Emit(IR::Block& block) {
     const auto range = boost::icl::discrete_interval<u32>::closed(descriptor.PC(), end_location.PC() - 1);
     block_ranges.AddRange(range, descriptor);
 
+    if (nzcv_live_entrypoint) {
+        nzcv_live_entrypoints.insert_or_assign(descriptor, nzcv_live_entrypoint);
+    } else {
+        nzcv_live_entrypoints.erase(descriptor);
+    }
+
     return RegisterBlock(descriptor, entrypoint, size);
 }
 
@@ -163,24 +219,71 @@ void A32EmitA64::ClearCache() {
     block_ranges.ClearCache();
     ClearFastDispatchTable();
     fastmem_patch_info.clear();
+    nzcv_live_entrypoints.clear();
+    nzcv_live_patch_locations.clear();
 }
 
 void A32EmitA64::InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
 
-void A32EmitA64::EmitCondPrelude(const A32EmitContext& ctx) {
+CodePtr A32EmitA64::EmitCondPrelude(const A32EmitContext& ctx) {
     if (ctx.block.GetCondition() == IR::Cond::AL) {
         ASSERT(!ctx.block.HasConditionFailedLocation());
-        return;
+        return nullptr;
     }
 
     ASSERT(ctx.block.HasConditionFailedLocation());
 
-    FixupBranch pass = EmitCond(ctx.block.GetCondition());
+    EmitLoadNZCV();
+    const CodePtr nzcv_live_entrypoint = code.GetCodePtr();
+    FixupBranch pass = EmitCondBranch(ctx.block.GetCondition());
     EmitAddCycles(ctx.block.ConditionFailedCycleCount());
     EmitTerminal(IR::Term::LinkBlock{ctx.block.ConditionFailedLocation()}, ctx.block.Location(),  ctx.IsSingleStep());
     code.SetJumpTarget(pass);
+    return nzcv_live_entrypoint;
+}
+
+// Opcodes whose emitted code leaves host NZCV untouched.
+static bool PreservesHostNZCV(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::Void:
+    case IR::Opcode::Identity:
+    case IR::Opcode::A32GetRegister:
+    case IR::Opcode::A32SetRegister:
+    case IR::Opcode::A32GetExtendedRegister32:
+    case IR::Opcode::A32GetExtendedRegister64:
+    case IR::Opcode::A32SetExtendedRegister32:
+    case IR::Opcode::A32SetExtendedRegister64:
+    case IR::Opcode::A32GetNFlag:
+    case IR::Opcode::A32GetZFlag:
+    case IR::Opcode::A32GetCFlag:
+    case IR::Opcode::A32GetVFlag:
+    case IR::Opcode::A32SetCheckBit:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void A32EmitA64::UpdateHostNZCV(A32EmitContext& ctx, IR::Inst* inst, const IR::Inst* nzcv_from_op) {
+    if (nzcv_from_op) {
+        // The flag-setting ADDS/SUBS/ADCS/SBCS that produced nzcv_from_op is the last write to host NZCV.
+        ctx.host_nzcv_value = nzcv_from_op;
+        ctx.nzcv_in_host = false;
+        return;
+    }
+
+    if (inst->GetOpcode() == IR::Opcode::A32SetCpsrNZCV) {
+        const IR::Value nzcv = inst->GetArg(0);
+        ctx.nzcv_in_host = !nzcv.IsImmediate() && nzcv.GetInst() == ctx.host_nzcv_value;
+        return;
+    }
+
+    if (inst->WritesToCPSR() || !PreservesHostNZCV(inst->GetOpcode())) {
+        ctx.host_nzcv_value = nullptr;
+        ctx.nzcv_in_host = false;
+    }
 }
 
 void A32EmitA64::ClearFastDispatchTable() {
@@ -238,6 +341,27 @@ void A32EmitA64::GenMemoryAccessors() {
     code.RET();
     PerfMapRegister(read_memory_64, code.GetCodePtr(), "a32_read_memory_64");
 
+    // There is no 128-bit callback, so the halves are read with MemoryRead64. The result is left in Q0.
+    code.AlignCode16();
+    read_memory_128 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::Q0);
+    code.ABI_PushRegisters(0x00180000);
+    code.MOV(W19, DecodeReg(code.ABI_PARAM2));
+    Devirtualize<&A32::UserCallbacks::MemoryRead64>(config.callbacks).EmitCall(code);
+    code.MOV(X20, code.ABI_RETURN);
+    code.ADD(DecodeReg(code.ABI_PARAM2), W19, 8);
+    Devirtualize<&A32::UserCallbacks::MemoryRead64>(config.callbacks).EmitCall(code);
+    code.fp_emitter.FMOV(EncodeRegToDouble(Q0), X20);
+    code.fp_emitter.INS(64, Q0, 1, code.ABI_RETURN);
+    code.ABI_PopRegisters(0x00180000);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::Q0);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(read_memory_128, code.GetCodePtr(), "a32_read_memory_128");
+
     code.AlignCode16();
     write_memory_8 = code.GetCodePtr();
     // Push lr and fp onto the stack
@@ -285,11 +409,33 @@ void A32EmitA64::GenMemoryAccessors() {
     code.ABI_PopRegisters(0x60000000);
     code.RET();
     PerfMapRegister(write_memory_64, code.GetCodePtr(), "a32_write_memory_64");
+
+    // The value to write is taken from Q0 and passed to MemoryWrite64 one half at a time.
+    code.AlignCode16();
+    write_memory_128 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    code.ABI_PushRegisters(0x00180000);
+    code.MOV(W19, DecodeReg(code.ABI_PARAM2));
+    code.fp_emitter.UMOV(64, X20, Q0, 1);
+    code.fp_emitter.UMOV(64, code.ABI_PARAM3, Q0, 0);
+    Devirtualize<&A32::UserCallbacks::MemoryWrite64>(config.callbacks).EmitCall(code);
+    code.ADD(DecodeReg(code.ABI_PARAM2), W19, 8);
+    code.MOV(code.ABI_PARAM3, X20);
+    Devirtualize<&A32::UserCallbacks::MemoryWrite64>(config.callbacks).EmitCall(code);
+    code.ABI_PopRegisters(0x00180000);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(write_memory_128, code.GetCodePtr(), "a32_write_memory_128");
 }
 
 void A32EmitA64::GenTerminalHandlers() {
-    const ARM64Reg fast_dispatch_entry_reg = X19;
-    const ARM64Reg location_descriptor_reg = X20;
+    // These must not overlap with the host registers guest registers may be pinned to.
+    const ARM64Reg fast_dispatch_entry_reg = X9;
+    const ARM64Reg location_descriptor_reg = X10;
 
     // PC ends up in fast_dispatch_entry_reg, location_descriptor ends up in location_descriptor_reg.
     const auto calculate_location_descriptor = [this, fast_dispatch_entry_reg, location_descriptor_reg] {
@@ -339,7 +485,9 @@ void A32EmitA64::GenTerminalHandlers() {
 
         code.SetJumpTarget(fast_dispatch_cache_miss);
         code.STR(INDEX_UNSIGNED, location_descriptor_reg, fast_dispatch_entry_reg, offsetof(FastDispatchEntry, location_descriptor) );
+        code.ABI_PushRegisters(1u << DecodeReg(fast_dispatch_entry_reg));
         code.LookupBlock();
+        code.ABI_PopRegisters(1u << DecodeReg(fast_dispatch_entry_reg));
         code.STR(INDEX_UNSIGNED, code.ABI_RETURN, fast_dispatch_entry_reg, offsetof(FastDispatchEntry, code_ptr));
         code.BR(code.ABI_RETURN);
         PerfMapRegister(terminal_handler_fast_dispatch_hint, code.GetCodePtr(), "a32_terminal_handler_fast_dispatch_hint");
@@ -359,7 +507,11 @@ void A32EmitA64::EmitA32GetRegister(A32EmitContext& ctx, IR::Inst* inst) {
     A32::Reg reg = inst->GetArg(0).GetA32RegRef();
 
     Arm64Gen::ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
-    code.LDR(INDEX_UNSIGNED, result, X28, MJitStateReg(reg));
+    if (const auto pinned = PinnedHostReg(reg)) {
+        code.MOV(result, *pinned);
+    } else {
+        code.LDR(INDEX_UNSIGNED, result, X28, MJitStateReg(reg));
+    }
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
@@ -384,7 +536,15 @@ void A32EmitA64::EmitA32GetExtendedRegister64(A32EmitContext& ctx, IR::Inst* ins
 void A32EmitA64::EmitA32SetRegister(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     A32::Reg reg = inst->GetArg(0).GetA32RegRef();
-    if (args[1].IsInFpr()) {
+    if (const auto pinned = PinnedHostReg(reg)) {
+        if (args[1].IsImmediate()) {
+            code.MOVI2R(*pinned, args[1].GetImmediateU32());
+        } else if (args[1].IsInFpr()) {
+            code.fp_emitter.FMOV(*pinned, EncodeRegToSingle(ctx.reg_alloc.UseFpr(args[1])));
+        } else {
+            code.MOV(*pinned, DecodeReg(ctx.reg_alloc.UseGpr(args[1])));
+        }
+    } else if (args[1].IsInFpr()) {
         Arm64Gen::ARM64Reg to_store = ctx.reg_alloc.UseFpr(args[1]);
         code.fp_emitter.STR(32, INDEX_UNSIGNED, to_store, X28, MJitStateReg(reg));
     } else {
@@ -467,7 +627,11 @@ void A32EmitA64::EmitA32SetCpsrNZCVRaw(A32EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A32EmitA64::EmitA32SetCpsrNZCV(A32EmitContext& ctx, IR::Inst* inst) {
-    EmitA32SetCpsrNZCVRaw(ctx, inst);
+    // NZCV values are produced in host NZCV layout, which is also the guest's layout.
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg nzcv = DecodeReg(ctx.reg_alloc.UseGpr(args[0]));
+
+    code.STR(INDEX_UNSIGNED, nzcv, X28, offsetof(A32JitState, cpsr_nzcv));
 }
 
 void A32EmitA64::EmitA32SetCpsrNZCVQ(A32EmitContext& ctx, IR::Inst* inst) {
@@ -501,8 +665,12 @@ void A32EmitA64::EmitA32SetCpsrNZCVQ(A32EmitContext& ctx, IR::Inst* inst) {
 
 void A32EmitA64::EmitA32GetNFlag(A32EmitContext& ctx, IR::Inst* inst) {
     Arm64Gen::ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
-    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
-    code.UBFX(result, result, 31, 1);
+    if (ctx.nzcv_in_host) {
+        code.CSET(result, CC_MI);
+    } else {
+        code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
+        code.UBFX(result, result, 31, 1);
+    }
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
@@ -529,8 +697,12 @@ void A32EmitA64::EmitA32SetNFlag(A32EmitContext& ctx, IR::Inst* inst) {
 
 void A32EmitA64::EmitA32GetZFlag(A32EmitContext& ctx, IR::Inst* inst) {
     Arm64Gen::ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
-    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
-    code.UBFX(result, result, 30, 1);
+    if (ctx.nzcv_in_host) {
+        code.CSET(result, CC_EQ);
+    } else {
+        code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
+        code.UBFX(result, result, 30, 1);
+    }
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
@@ -563,8 +735,12 @@ void A32EmitA64::EmitA32SetCheckBit(A32EmitContext& ctx, IR::Inst* inst) {
 
 void A32EmitA64::EmitA32GetCFlag(A32EmitContext& ctx, IR::Inst* inst) {
     Arm64Gen::ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
-    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
-    code.UBFX(result, result, 29, 1);
+    if (ctx.nzcv_in_host) {
+        code.CSET(result, CC_CS);
+    } else {
+        code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
+        code.UBFX(result, result, 29, 1);
+    }
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
@@ -590,8 +766,12 @@ void A32EmitA64::EmitA32SetCFlag(A32EmitContext& ctx, IR::Inst* inst) {
 
 void A32EmitA64::EmitA32GetVFlag(A32EmitContext& ctx, IR::Inst* inst) {
     Arm64Gen::ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
-    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
-    code.UBFX(result, result, 28, 1);
+    if (ctx.nzcv_in_host) {
+        code.CSET(result, CC_VS);
+    } else {
+        code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A32JitState, cpsr_nzcv));
+        code.UBFX(result, result, 28, 1);
+    }
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
@@ -722,6 +902,7 @@ void A32EmitA64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
 void A32EmitA64::EmitA32CallSupervisor(A32EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.HostCall(nullptr);
 
+    code.StorePinnedRegisters();
     code.SwitchFpscrOnExit();
     code.LDR(INDEX_UNSIGNED, code.ABI_PARAM2, X28, offsetof(A32JitState, cycles_to_run));
     code.SUB(code.ABI_PARAM2, code.ABI_PARAM2, X26);
@@ -735,6 +916,7 @@ void A32EmitA64::EmitA32CallSupervisor(A32EmitContext& ctx, IR::Inst* inst) {
     code.STR(INDEX_UNSIGNED, code.ABI_RETURN, X28, offsetof(A32JitState, cycles_to_run));
     code.MOV(X26, code.ABI_RETURN);
     code.SwitchFpscrOnEntry();
+    code.LoadPinnedRegisters();
 }
 
 void A32EmitA64::EmitA32ExceptionRaised(A32EmitContext& ctx, IR::Inst* inst) {
@@ -743,10 +925,35 @@ void A32EmitA64::EmitA32ExceptionRaised(A32EmitContext& ctx, IR::Inst* inst) {
     ASSERT(args[0].IsImmediate() && args[1].IsImmediate());
     u32 pc = args[0].GetImmediateU32();
     u64 exception = args[1].GetImmediateU64();
+    code.StorePinnedRegisters();
     Devirtualize<&A32::UserCallbacks::ExceptionRaised>(config.callbacks).EmitCall(code, [&](RegList param) {
         code.MOVI2R(param[0], pc);
         code.MOVI2R(param[1], exception);
     });
+    code.LoadPinnedRegisters();
+}
+
+void A32EmitA64::EmitA32DataSynchronizationBarrier(A32EmitContext&, IR::Inst*) {
+    code.DSB(ISH);
+}
+
+void A32EmitA64::EmitA32DataMemoryBarrier(A32EmitContext&, IR::Inst*) {
+    code.DMB(ISH);
+}
+
+static void ClearCacheImpl(A32::Jit* jit) {
+    jit->ClearCache();
+}
+
+void A32EmitA64::EmitA32InstructionSynchronizationBarrier(A32EmitContext& ctx, IR::Inst*) {
+    ctx.reg_alloc.HostCall(nullptr);
+
+    code.MOVP2R(code.ABI_PARAM1, jit_interface);
+    code.QuickCallFunction(&ClearCacheImpl);
+}
+
+void A32EmitA64::EmitA32OrderedAccessBarrier(A32EmitContext&, IR::Inst*) {
+    code.DMB(ISH);
 }
 
 static u32 GetFpscrImpl(A32JitState* jit_state) {
@@ -807,17 +1014,6 @@ void A32EmitA64::EmitA32ClearExclusive(A32EmitContext&, IR::Inst*) {
     code.STR(INDEX_UNSIGNED, WZR, X28, offsetof(A32JitState, exclusive_state));
 }
 
-void A32EmitA64::EmitA32SetExclusive(A32EmitContext& ctx, IR::Inst* inst) {
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ASSERT(args[1].IsImmediate());
-    Arm64Gen::ARM64Reg address = DecodeReg(ctx.reg_alloc.UseGpr(args[0]));
-    Arm64Gen::ARM64Reg state = DecodeReg(ctx.reg_alloc.ScratchGpr());
-
-    code.MOVI2R(state, u8(1));
-    code.STR(INDEX_UNSIGNED, state, X28, offsetof(A32JitState, exclusive_state));
-    code.STR(INDEX_UNSIGNED, address, X28, offsetof(A32JitState, exclusive_address));
-}
-
 A32EmitA64::DoNotFastmemMarker A32EmitA64::GenerateDoNotFastmemMarker(A32EmitContext& ctx, IR::Inst* inst) {
     return std::make_tuple(ctx.Location(), ctx.GetInstOffset(inst));
 }
@@ -826,13 +1022,17 @@ bool A32EmitA64::ShouldFastmem(const DoNotFastmemMarker& marker) const {
     return config.fastmem_pointer && exception_handler.SupportsFastmem() && do_not_fastmem.count(marker) == 0;
 }
 
+bool A32EmitA64::ShouldFastmemExclusive() const {
+    return config.fastmem_exclusive_access && config.fastmem_pointer && exception_handler.SupportsFastmem();
+}
+
 void A32EmitA64::DoNotFastmem(const DoNotFastmemMarker& marker) {
     do_not_fastmem.emplace(marker);
     InvalidateBasicBlocks({std::get<0>(marker)});
 }
 
 template <typename T>
-void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn) {
+void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn, bool exclusive) {
     constexpr size_t bit_size = Common::BitSize<T>();
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -843,14 +1043,32 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
     ARM64Reg vaddr = DecodeReg(code.ABI_PARAM2);
     ARM64Reg tmp = code.ABI_RETURN;
 
+    if (exclusive) {
+        // The page table lookup clobbers vaddr, so the reservation is recorded up front.
+        code.MOVI2R(DecodeReg(tmp), u32(1));
+        code.STR(INDEX_UNSIGNED, DecodeReg(tmp), X28, offsetof(A32JitState, exclusive_state));
+        code.STR(INDEX_UNSIGNED, vaddr, X28, offsetof(A32JitState, exclusive_address));
+    }
+
     const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
 
     const auto page_table_lookup = [this, result, vaddr, tmp, callback_fn](FixupBranch& end) {
         constexpr size_t bit_size = Common::BitSize<T>();
 
+        // 64-bit accesses may have been coalesced from 32-bit ones, so those that straddle a page
+        // boundary are sent to the memory callbacks.
+        FixupBranch straddle{};
+        if (bit_size >= 64) {
+            code.ANDI2R(DecodeReg(tmp), vaddr, 4095);
+            code.CMPI2R(DecodeReg(tmp), 4096 - bit_size / 8);
+            straddle = code.B(CC_HI);
+        }
         code.MOVP2R(result, config.page_table);
         code.MOV(tmp, vaddr, ArithOption{vaddr, ST_LSR, 12});
         code.LDR(result, result, ArithOption{tmp, true});
+        if (config.page_table_attribute_bits) {
+            code.ANDI2R(result, result, ~u64(A32::UserConfig::PAGE_ATTRIBUTE_MASK));
+        }
         FixupBranch abort = code.CBZ(result);
         code.ANDI2R(vaddr, vaddr, 4095);
         switch (bit_size) {
@@ -872,6 +1090,9 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
         }
         end = code.B();
         code.SetJumpTarget(abort);
+        if (bit_size >= 64) {
+            code.SetJumpTarget(straddle);
+        }
         code.BL(callback_fn);
         code.MOV(result, code.ABI_RETURN);
     };
@@ -897,33 +1118,32 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
                 break;
         }
 
-        fastmem_patch_info.emplace(
+        AddFastmemPatchInfo(FastmemPatchInfo{
                 patch_location,
-                FastmemPatchInfo{
-                        [this, patch_location, page_table_lookup, callback_fn, result, do_not_fastmem_marker]{
-                            CodePtr save_code_ptr = code.GetCodePtr();
-                            code.SetCodePtr(patch_location);
-                            FixupBranch thunk = code.B();
-                            u8* end_ptr = code.GetWritableCodePtr();
-                            code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
-                            code.SetCodePtr(save_code_ptr);
-                            code.SwitchToFarCode();
-                            code.SetJumpTarget(thunk);
-                            if (config.page_table) {
-                                FixupBranch end{};
-                                page_table_lookup(end);
-                                code.SetJumpTarget(end, end_ptr);
-                            } else {
-                                code.BL(callback_fn);
-                                code.MOV(result, code.ABI_RETURN);
-                            }
-                            code.B(end_ptr);
-                            code.FlushIcache();
-                            code.SwitchToNearCode();
-
-                            DoNotFastmem(do_not_fastmem_marker);
-                        }
-                });
+                [this, patch_location, page_table_lookup, callback_fn, result, do_not_fastmem_marker]{
+                    CodePtr save_code_ptr = code.GetCodePtr();
+                    code.SetCodePtr(patch_location);
+                    FixupBranch thunk = code.B();
+                    u8* end_ptr = code.GetWritableCodePtr();
+                    code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
+                    code.SetCodePtr(save_code_ptr);
+                    code.SwitchToFarCode();
+                    code.SetJumpTarget(thunk);
+                    if (config.page_table) {
+                        FixupBranch end{};
+                        page_table_lookup(end);
+                        code.SetJumpTarget(end, end_ptr);
+                    } else {
+                        code.BL(callback_fn);
+                        code.MOV(result, code.ABI_RETURN);
+                    }
+                    code.B(end_ptr);
+                    code.FlushIcache();
+                    code.SwitchToNearCode();
+
+                    DoNotFastmem(do_not_fastmem_marker);
+                }
+        });
 
         ctx.reg_alloc.DefineValue(inst, result);
         return;
@@ -962,9 +1182,23 @@ void A32EmitA64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr
     const auto page_table_lookup = [this, vaddr, value, page_index, addr, callback_fn](FixupBranch& end) {
         constexpr size_t bit_size = Common::BitSize<T>();
 
+        // 64-bit accesses may have been coalesced from 32-bit ones, so those that straddle a page
+        // boundary are sent to the memory callbacks.
+        FixupBranch straddle{};
+        if (bit_size >= 64) {
+            code.ANDI2R(DecodeReg(page_index), vaddr, 4095);
+            code.CMPI2R(DecodeReg(page_index), 4096 - bit_size / 8);
+            straddle = code.B(CC_HI);
+        }
         code.MOVP2R(addr, config.page_table);
         code.MOV(DecodeReg(page_index), vaddr, ArithOption{vaddr, ST_LSR, 12});
         code.LDR(addr, addr, ArithOption{page_index, true});
+        FixupBranch write_callback{};
+        if (config.page_table_attribute_bits) {
+            code.TSTI2R(addr, A32::UserConfig::PAGE_ATTRIBUTE_MASK);
+            write_callback = code.B(CC_NEQ);
+            code.ANDI2R(addr, addr, ~u64(A32::UserConfig::PAGE_ATTRIBUTE_MASK));
+        }
         FixupBranch abort = code.CBZ(addr);
         code.ANDI2R(vaddr, vaddr, 4095);
         switch (bit_size) {
@@ -986,6 +1220,12 @@ void A32EmitA64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr
         }
         end = code.B();
         code.SetJumpTarget(abort);
+        if (config.page_table_attribute_bits) {
+            code.SetJumpTarget(write_callback);
+        }
+        if (bit_size >= 64) {
+            code.SetJumpTarget(straddle);
+        }
         code.BL(callback_fn);
     };
 
@@ -1009,32 +1249,31 @@ void A32EmitA64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr
                 break;
         }
 
-        fastmem_patch_info.emplace(
+        AddFastmemPatchInfo(FastmemPatchInfo{
                 patch_location,
-                FastmemPatchInfo{
-                        [this, patch_location, page_table_lookup, callback_fn, do_not_fastmem_marker]{
-                            CodePtr save_code_ptr = code.GetCodePtr();
-                            code.SetCodePtr(patch_location);
-                            FixupBranch thunk = code.B();
-                            u8* end_ptr = code.GetWritableCodePtr();
-                            code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
-                            code.SetCodePtr(save_code_ptr);
-                            code.SwitchToFarCode();
-                            code.SetJumpTarget(thunk);
-                            if (config.page_table) {
-                                FixupBranch end{};
-                                page_table_lookup(end);
-                                code.SetJumpTarget(end, end_ptr);
-                            } else {
-                                code.BL(callback_fn);
-                            }
-                            code.B(end_ptr);
-                            code.FlushIcache();
-                            code.SwitchToNearCode();
-
-                            DoNotFastmem(do_not_fastmem_marker);
-                        }
-                });
+                [this, patch_location, page_table_lookup, callback_fn, do_not_fastmem_marker]{
+                    CodePtr save_code_ptr = code.GetCodePtr();
+                    code.SetCodePtr(patch_location);
+                    FixupBranch thunk = code.B();
+                    u8* end_ptr = code.GetWritableCodePtr();
+                    code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
+                    code.SetCodePtr(save_code_ptr);
+                    code.SwitchToFarCode();
+                    code.SetJumpTarget(thunk);
+                    if (config.page_table) {
+                        FixupBranch end{};
+                        page_table_lookup(end);
+                        code.SetJumpTarget(end, end_ptr);
+                    } else {
+                        code.BL(callback_fn);
+                    }
+                    code.B(end_ptr);
+                    code.FlushIcache();
+                    code.SwitchToNearCode();
+
+                    DoNotFastmem(do_not_fastmem_marker);
+                }
+        });
         return;
     }
 
@@ -1080,6 +1319,411 @@ void A32EmitA64::EmitA32WriteMemory64(A32EmitContext& ctx, IR::Inst* inst) {
     WriteMemory<u64>(ctx, inst, write_memory_64);
 }
 
+void A32EmitA64::EmitA32ReadMemory128(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    ctx.reg_alloc.ScratchGpr({ABI_RETURN});
+
+    // The 128-bit callback thunk leaves its result in Q0.
+    ARM64Reg result = ctx.reg_alloc.ScratchFpr({HostLoc::Q0});
+    ARM64Reg page = ctx.reg_alloc.ScratchGpr();
+    ARM64Reg vaddr = DecodeReg(code.ABI_PARAM2);
+    ARM64Reg tmp = code.ABI_RETURN;
+
+    const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
+
+    const auto page_table_lookup = [this, result, page, vaddr, tmp](FixupBranch& end) {
+        // Multi-register loads that straddle a page boundary are sent to the memory callbacks.
+        code.ANDI2R(DecodeReg(tmp), vaddr, 4095);
+        code.CMPI2R(DecodeReg(tmp), 4096 - 16);
+        FixupBranch straddle = code.B(CC_HI);
+        code.MOVP2R(page, config.page_table);
+        code.MOV(tmp, vaddr, ArithOption{vaddr, ST_LSR, 12});
+        code.LDR(page, page, ArithOption{tmp, true});
+        if (config.page_table_attribute_bits) {
+            code.ANDI2R(page, page, ~u64(A32::UserConfig::PAGE_ATTRIBUTE_MASK));
+        }
+        FixupBranch abort = code.CBZ(page);
+        code.ANDI2R(vaddr, vaddr, 4095);
+        code.fp_emitter.LDR(128, result, page, vaddr);
+        end = code.B();
+        code.SetJumpTarget(abort);
+        code.SetJumpTarget(straddle);
+        code.BL(read_memory_128);
+    };
+
+    if (ShouldFastmem(do_not_fastmem_marker)) {
+        const CodePtr patch_location = code.GetCodePtr();
+        code.fp_emitter.LDR(128, result, X27, vaddr);
+
+        AddFastmemPatchInfo(FastmemPatchInfo{
+                patch_location,
+                [this, patch_location, page_table_lookup, do_not_fastmem_marker]{
+                    CodePtr save_code_ptr = code.GetCodePtr();
+                    code.SetCodePtr(patch_location);
+                    FixupBranch thunk = code.B();
+                    u8* end_ptr = code.GetWritableCodePtr();
+                    code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
+                    code.SetCodePtr(save_code_ptr);
+                    code.SwitchToFarCode();
+                    code.SetJumpTarget(thunk);
+                    if (config.page_table) {
+                        FixupBranch end{};
+                        page_table_lookup(end);
+                        code.SetJumpTarget(end, end_ptr);
+                    } else {
+                        code.BL(read_memory_128);
+                    }
+                    code.B(end_ptr);
+                    code.FlushIcache();
+                    code.SwitchToNearCode();
+
+                    DoNotFastmem(do_not_fastmem_marker);
+                }
+        });
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (!config.page_table) {
+        code.BL(read_memory_128);
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    FixupBranch end{};
+    page_table_lookup(end);
+    code.SetJumpTarget(end);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A32EmitA64::EmitA32WriteMemory128(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({ABI_RETURN});
+    ctx.reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    // The 128-bit callback thunk takes its value from Q0.
+    ctx.reg_alloc.Use(args[1], HostLoc::Q0);
+
+    ARM64Reg vaddr = DecodeReg(code.ABI_PARAM2);
+    ARM64Reg value = Q0;
+    ARM64Reg page_index = ctx.reg_alloc.ScratchGpr();
+    ARM64Reg addr = ctx.reg_alloc.ScratchGpr();
+
+    const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
+
+    const auto page_table_lookup = [this, vaddr, value, page_index, addr](FixupBranch& end) {
+        // Multi-register stores that straddle a page boundary are sent to the memory callbacks.
+        code.ANDI2R(DecodeReg(page_index), vaddr, 4095);
+        code.CMPI2R(DecodeReg(page_index), 4096 - 16);
+        FixupBranch straddle = code.B(CC_HI);
+        code.MOVP2R(addr, config.page_table);
+        code.MOV(DecodeReg(page_index), vaddr, ArithOption{vaddr, ST_LSR, 12});
+        code.LDR(addr, addr, ArithOption{page_index, true});
+        FixupBranch write_callback{};
+        if (config.page_table_attribute_bits) {
+            code.TSTI2R(addr, A32::UserConfig::PAGE_ATTRIBUTE_MASK);
+            write_callback = code.B(CC_NEQ);
+            code.ANDI2R(addr, addr, ~u64(A32::UserConfig::PAGE_ATTRIBUTE_MASK));
+        }
+        FixupBranch abort = code.CBZ(addr);
+        code.ANDI2R(vaddr, vaddr, 4095);
+        code.fp_emitter.STR(128, value, addr, vaddr);
+        end = code.B();
+        code.SetJumpTarget(abort);
+        if (config.page_table_attribute_bits) {
+            code.SetJumpTarget(write_callback);
+        }
+        code.SetJumpTarget(straddle);
+        code.BL(write_memory_128);
+    };
+
+    if (ShouldFastmem(do_not_fastmem_marker)) {
+        const CodePtr patch_location = code.GetCodePtr();
+        code.fp_emitter.STR(128, value, X27, vaddr);
+
+        AddFastmemPatchInfo(FastmemPatchInfo{
+                patch_location,
+                [this, patch_location, page_table_lookup, do_not_fastmem_marker]{
+                    CodePtr save_code_ptr = code.GetCodePtr();
+                    code.SetCodePtr(patch_location);
+                    FixupBranch thunk = code.B();
+                    u8* end_ptr = code.GetWritableCodePtr();
+                    code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
+                    code.SetCodePtr(save_code_ptr);
+                    code.SwitchToFarCode();
+                    code.SetJumpTarget(thunk);
+                    if (config.page_table) {
+                        FixupBranch end{};
+                        page_table_lookup(end);
+                        code.SetJumpTarget(end, end_ptr);
+                    } else {
+                        code.BL(write_memory_128);
+                    }
+                    code.B(end_ptr);
+                    code.FlushIcache();
+                    code.SwitchToNearCode();
+
+                    DoNotFastmem(do_not_fastmem_marker);
+                }
+        });
+        return;
+    }
+
+    if (!config.page_table) {
+        code.BL(write_memory_128);
+        return;
+    }
+
+    FixupBranch end{};
+    page_table_lookup(end);
+    code.SetJumpTarget(end);
+}
+
+template<typename T>
+void A32EmitA64::FastmemExclusiveRead(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn) {
+    constexpr size_t bit_size = Common::BitSize<T>();
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    ctx.reg_alloc.ScratchGpr({ABI_RETURN});
+
+    ARM64Reg vaddr = DecodeReg(code.ABI_PARAM2);
+    ARM64Reg value = code.ABI_RETURN;
+    ARM64Reg state = DecodeReg(ctx.reg_alloc.ScratchGpr());
+
+    const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
+
+    // The observed value is recorded even when this access cannot use fastmem,
+    // as the exclusive write compares against it.
+    if (ShouldFastmem(do_not_fastmem_marker)) {
+        const CodePtr patch_location = code.GetCodePtr();
+        switch (bit_size) {
+            case 8:
+                code.LDRB(DecodeReg(value), X27, vaddr);
+                break;
+            case 16:
+                code.LDRH(DecodeReg(value), X27, vaddr);
+                break;
+            case 32:
+                code.LDR(DecodeReg(value), X27, vaddr);
+                break;
+            case 64:
+                code.LDR(value, X27, vaddr);
+                break;
+        }
+
+        AddFastmemPatchInfo(FastmemPatchInfo{
+                patch_location,
+                [this, patch_location, callback_fn, do_not_fastmem_marker]{
+                    CodePtr save_code_ptr = code.GetCodePtr();
+                    code.SetCodePtr(patch_location);
+                    FixupBranch thunk = code.B();
+                    u8* end_ptr = code.GetWritableCodePtr();
+                    code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
+                    code.SetCodePtr(save_code_ptr);
+                    code.SwitchToFarCode();
+                    code.SetJumpTarget(thunk);
+                    code.BL(callback_fn);
+                    code.B(end_ptr);
+                    code.FlushIcache();
+                    code.SwitchToNearCode();
+
+                    DoNotFastmem(do_not_fastmem_marker);
+                }
+        });
+    } else {
+        code.BL(callback_fn);
+    }
+
+    // The callbacks leave the upper bits of narrow return values undefined.
+    switch (bit_size) {
+        case 8:
+            code.UXTB(DecodeReg(value), DecodeReg(value));
+            break;
+        case 16:
+            code.UXTH(DecodeReg(value), DecodeReg(value));
+            break;
+        case 32:
+            code.MOV(DecodeReg(value), DecodeReg(value));
+            break;
+    }
+
+    code.MOVI2R(state, u8(1));
+    code.STR(INDEX_UNSIGNED, state, X28, offsetof(A32JitState, exclusive_state));
+    code.STR(INDEX_UNSIGNED, vaddr, X28, offsetof(A32JitState, exclusive_address));
+    code.STR(INDEX_UNSIGNED, value, X28, offsetof(A32JitState, exclusive_value));
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A32EmitA64::EmitA32ExclusiveReadMemory8(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveRead<u8>(ctx, inst, read_memory_8);
+        return;
+    }
+    ReadMemory<u8>(ctx, inst, read_memory_8, true);
+}
+
+void A32EmitA64::EmitA32ExclusiveReadMemory16(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveRead<u16>(ctx, inst, read_memory_16);
+        return;
+    }
+    ReadMemory<u16>(ctx, inst, read_memory_16, true);
+}
+
+void A32EmitA64::EmitA32ExclusiveReadMemory32(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveRead<u32>(ctx, inst, read_memory_32);
+        return;
+    }
+    ReadMemory<u32>(ctx, inst, read_memory_32, true);
+}
+
+void A32EmitA64::EmitA32ExclusiveReadMemory64(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveRead<u64>(ctx, inst, read_memory_64);
+        return;
+    }
+    ReadMemory<u64>(ctx, inst, read_memory_64, true);
+}
+
+template<typename T>
+void A32EmitA64::FastmemExclusiveWrite(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn) {
+    constexpr size_t bit_size = Common::BitSize<T>();
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({ABI_RETURN});
+    ctx.reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    ctx.reg_alloc.UseScratch(args[1], ABI_PARAM3);
+    if (bit_size == 64) {
+        ctx.reg_alloc.UseScratch(args[2], ABI_PARAM4);
+    }
+
+    ARM64Reg vaddr = DecodeReg(code.ABI_PARAM2);
+    ARM64Reg value = code.ABI_PARAM3;
+    ARM64Reg passed = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    ARM64Reg tmp = ctx.reg_alloc.ScratchGpr();
+    ARM64Reg expected = ctx.reg_alloc.ScratchGpr();
+    ARM64Reg addr = ctx.reg_alloc.ScratchGpr();
+
+    const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
+
+    std::vector<FixupBranch> end;
+
+    code.MOVI2R(passed, u32(1));
+    code.LDR(INDEX_UNSIGNED, DecodeReg(tmp), X28, offsetof(A32JitState, exclusive_state));
+    end.push_back(code.CBZ(DecodeReg(tmp)));
+    code.LDR(INDEX_UNSIGNED, DecodeReg(tmp), X28, offsetof(A32JitState, exclusive_address));
+    code.EOR(DecodeReg(tmp), vaddr, DecodeReg(tmp));
+    code.TSTI2R(DecodeReg(tmp), A32JitState::RESERVATION_GRANULE_MASK, DecodeReg(addr));
+    end.push_back(code.B(CC_NEQ));
+    code.STR(INDEX_UNSIGNED, WZR, X28, offsetof(A32JitState, exclusive_state));
+    if (bit_size == 64) {
+        code.LSL(code.ABI_PARAM4, code.ABI_PARAM4, 32);
+        code.ORR(value, value, code.ABI_PARAM4);
+    }
+
+    if (!ShouldFastmem(do_not_fastmem_marker)) {
+        code.BL(callback_fn);
+        code.MOVI2R(passed, 0);
+        for (FixupBranch e : end) {
+            code.SetJumpTarget(e);
+        }
+        ctx.reg_alloc.DefineValue(inst, passed);
+        return;
+    }
+
+    // Commit with a compare-and-swap against the value observed by the exclusive load.
+    // Host exclusives fault on misaligned addresses, so those take the callback.
+    FixupBranch misaligned{};
+    if (bit_size != 8) {
+        code.TSTI2R(vaddr, bit_size / 8 - 1, DecodeReg(addr));
+        misaligned = code.B(CC_NEQ);
+    }
+    code.LDR(INDEX_UNSIGNED, expected, X28, offsetof(A32JitState, exclusive_value));
+    code.MOV(DecodeReg(addr), vaddr);
+    code.ADD(addr, X27, addr);
+
+    const CodePtr retry = code.GetCodePtr();
+    const CodePtr load_location = code.GetCodePtr();
+    switch (bit_size) {
+        case 8:
+            code.LDAXRB(DecodeReg(tmp), addr);
+            break;
+        case 16:
+            code.LDAXRH(DecodeReg(tmp), addr);
+            break;
+        case 32:
+            code.LDAXR(DecodeReg(tmp), addr);
+            break;
+        case 64:
+            code.LDAXR(tmp, addr);
+            break;
+        default:
+            ASSERT_FALSE("Invalid bit_size");
+            break;
+    }
+    code.CMP(tmp, expected);
+    FixupBranch mismatch = code.B(CC_NEQ);
+    const CodePtr store_location = code.GetCodePtr();
+    switch (bit_size) {
+        case 8:
+            code.STLXRB(DecodeReg(tmp), DecodeReg(value), addr);
+            break;
+        case 16:
+            code.STLXRH(DecodeReg(tmp), DecodeReg(value), addr);
+            break;
+        case 32:
+            code.STLXR(DecodeReg(tmp), DecodeReg(value), addr);
+            break;
+        case 64:
+            code.STLXR(DecodeReg(tmp), value, addr);
+            break;
+    }
+    code.CBNZ(DecodeReg(tmp), retry);
+    code.MOVI2R(passed, 0);
+    end.push_back(code.B());
+
+    const CodePtr fallback = code.GetCodePtr();
+    if (bit_size != 8) {
+        code.SetJumpTarget(misaligned);
+    }
+    code.BL(callback_fn);
+    code.MOVI2R(passed, 0);
+    end.push_back(code.B());
+
+    code.SetJumpTarget(mismatch);
+    code.CLREX();
+
+    for (FixupBranch e : end) {
+        code.SetJumpTarget(e);
+    }
+
+    // A faulting load or store is patched into a branch to the callback path.
+    for (const CodePtr patch_location : {load_location, store_location}) {
+        AddFastmemPatchInfo(FastmemPatchInfo{
+                patch_location,
+                [this, patch_location, fallback, do_not_fastmem_marker]{
+                    CodePtr save_code_ptr = code.GetCodePtr();
+                    code.SetCodePtr(patch_location);
+                    code.B(fallback);
+                    u8* end_ptr = code.GetWritableCodePtr();
+                    code.FlushIcacheSection(reinterpret_cast<const u8*>(patch_location), end_ptr);
+                    code.SetCodePtr(save_code_ptr);
+
+                    DoNotFastmem(do_not_fastmem_marker);
+                }
+        });
+    }
+
+    ctx.reg_alloc.DefineValue(inst, passed);
+}
+
 template <typename T, void (A32::UserCallbacks::*fn)(A32::VAddr, T)>
 static void ExclusiveWrite(BlockOfCode& code, RegAlloc& reg_alloc, IR::Inst* inst, const A32::UserConfig& config, bool prepend_high_word) {
     auto args = reg_alloc.GetArgumentInfo(inst);
@@ -1117,18 +1761,34 @@ static void ExclusiveWrite(BlockOfCode& code, RegAlloc& reg_alloc, IR::Inst* ins
 }
 
 void A32EmitA64::EmitA32ExclusiveWriteMemory8(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveWrite<u8>(ctx, inst, write_memory_8);
+        return;
+    }
     ExclusiveWrite<u8, &A32::UserCallbacks::MemoryWrite8>(code, ctx.reg_alloc, inst, config, false);
 }
 
 void A32EmitA64::EmitA32ExclusiveWriteMemory16(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveWrite<u16>(ctx, inst, write_memory_16);
+        return;
+    }
     ExclusiveWrite<u16, &A32::UserCallbacks::MemoryWrite16>(code, ctx.reg_alloc, inst, config, false);
 }
 
 void A32EmitA64::EmitA32ExclusiveWriteMemory32(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveWrite<u32>(ctx, inst, write_memory_32);
+        return;
+    }
     ExclusiveWrite<u32, &A32::UserCallbacks::MemoryWrite32>(code, ctx.reg_alloc, inst, config, false);
 }
 
 void A32EmitA64::EmitA32ExclusiveWriteMemory64(A32EmitContext& ctx, IR::Inst* inst) {
+    if (ShouldFastmemExclusive()) {
+        FastmemExclusiveWrite<u64>(ctx, inst, write_memory_64);
+        return;
+    }
     ExclusiveWrite<u64, &A32::UserCallbacks::MemoryWrite64>(code, ctx.reg_alloc, inst, config, true);
 }
 
@@ -1145,7 +1805,9 @@ static void CallCoprocCallback(BlockOfCode& code, RegAlloc& reg_alloc, A32::Jit*
         code.MOVP2R(code.ABI_PARAM2, *callback.user_arg);
     }
 
+    code.StorePinnedRegisters();
     code.QuickCallFunction(callback.function);
+    code.LoadPinnedRegisters();
 }
 
 void A32EmitA64::EmitA32CoprocInternalOperation(A32EmitContext& ctx, IR::Inst* inst) {
@@ -1407,11 +2069,20 @@ std::string A32EmitA64::LocationDescriptorToFriendlyName(const IR::LocationDescr
                        descriptor.FPSCR().Value());
 }
 
+void A32EmitA64::AddFastmemPatchInfo(FastmemPatchInfo info) {
+    // Code is mostly emitted at increasing addresses, so this is almost always an append.
+    const auto iter = std::upper_bound(fastmem_patch_info.begin(), fastmem_patch_info.end(), info.location,
+                                       [](CodePtr location, const FastmemPatchInfo& x) { return location < x.location; });
+    fastmem_patch_info.insert(iter, std::move(info));
+}
+
 void A32EmitA64::FastmemCallback(CodePtr PC) {
-    const auto iter = fastmem_patch_info.find(PC);
-    ASSERT(iter != fastmem_patch_info.end());
-    iter->second.callback();
+    const auto iter = std::lower_bound(fastmem_patch_info.begin(), fastmem_patch_info.end(), PC,
+                                       [](const FastmemPatchInfo& x, CodePtr location) { return x.location < location; });
+    ASSERT(iter != fastmem_patch_info.end() && iter->location == PC);
+    const auto callback = std::move(iter->callback);
     fastmem_patch_info.erase(iter);
+    callback();
 }
 
 void A32EmitA64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor initial_location, bool) {
@@ -1422,7 +2093,9 @@ void A32EmitA64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDesc
     code.MOVI2R(DecodeReg(code.ABI_PARAM3), terminal.num_instructions);
     code.STR(INDEX_UNSIGNED, DecodeReg(code.ABI_PARAM2), X28, MJitStateReg(A32::Reg::PC));
     code.SwitchFpscrOnExit();
+    code.StorePinnedRegisters();
     Devirtualize<&A32::UserCallbacks::InterpreterFallback>(config.callbacks).EmitCall(code);
+    code.LoadPinnedRegisters();
     code.ReturnFromRunCode(true); // TODO: Check cycles
 }
 
@@ -1492,6 +2165,9 @@ void A32EmitA64::EmitTerminalImpl(IR::Term::LinkBlockFast terminal, IR::Location
     }
 
     patch_information[terminal.next].jmp.emplace_back(code.GetCodePtr());
+    if (nzcv_live_at_terminal) {
+        nzcv_live_patch_locations.emplace(code.GetCodePtr());
+    }
     if (auto next_bb = GetBasicBlock(terminal.next)) {
         EmitPatchJmp(terminal.next, next_bb->entrypoint);
     } else {
@@ -1516,7 +2192,9 @@ void A32EmitA64::EmitTerminalImpl(IR::Term::FastDispatchHint, IR::LocationDescri
 }
 
 void A32EmitA64::EmitTerminalImpl(IR::Term::If terminal, IR::LocationDescriptor initial_location, bool is_single_step) {
-    FixupBranch pass = EmitCond(terminal.if_);
+    FixupBranch pass = nzcv_live_at_terminal ? EmitCondBranch(terminal.if_) : EmitCond(terminal.if_);
+    // Both arms are entered with host NZCV holding the guest's flags.
+    nzcv_live_at_terminal = true;
     EmitTerminal(terminal.else_, initial_location, is_single_step);
     code.SetJumpTarget(pass);
     EmitTerminal(terminal.then_, initial_location, is_single_step);
@@ -1568,6 +2246,12 @@ void A32EmitA64::EmitPatchJg(const IR::LocationDescriptor& target_desc, CodePtr
 
 void A32EmitA64::EmitPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
     const CodePtr patch_location = code.GetCodePtr();
+    if (target_code_ptr && nzcv_live_patch_locations.count(patch_location)) {
+        // Host NZCV already holds the guest's flags here, so skip the target's NZCV reload.
+        if (const auto iter = nzcv_live_entrypoints.find(target_desc); iter != nzcv_live_entrypoints.end()) {
+            target_code_ptr = iter->second;
+        }
+    }
     if (target_code_ptr) {
         code.B(target_code_ptr);
     } else {
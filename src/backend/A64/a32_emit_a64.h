@@ -12,6 +12,8 @@
 #include <set>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "backend/A64/a32_jitstate.h"
 #include "backend/A64/block_range_information.h"
@@ -36,6 +38,11 @@ struct A32EmitContext final : public EmitContext {
     bool FPSCR_FTZ() const override;
     bool FPSCR_DN() const override;
     std::ptrdiff_t GetInstOffset(IR::Inst* inst) const;
+
+    /// The GetNZCVFromOp value host NZCV was last set to, if it has not been clobbered since.
+    const IR::Inst* host_nzcv_value = nullptr;
+    /// True while host NZCV holds the guest's NZCV flags.
+    bool nzcv_in_host = false;
 };
 
 class A32EmitA64 final : public EmitA64 {
@@ -55,13 +62,28 @@ public:
 
     void FastmemCallback(CodePtr PC);
 
+    /// Guest registers that live in host registers while running, as requested by config.
+    static std::vector<PinnedRegister> PinnedRegisters(const A32::UserConfig& config);
+
 protected:
     const A32::UserConfig config;
     A32::Jit* jit_interface;
     BlockRangeInformation<u32> block_ranges;
     ExceptionHandler exception_handler;
 
-    void EmitCondPrelude(const A32EmitContext& ctx);
+    /// Allocation order of general-purpose registers, excluding those guest registers are pinned to.
+    std::vector<HostLoc> gpr_order;
+    std::optional<Arm64Gen::ARM64Reg> PinnedHostReg(A32::Reg reg) const;
+
+    CodePtr EmitCondPrelude(const A32EmitContext& ctx);
+    void UpdateHostNZCV(A32EmitContext& ctx, IR::Inst* inst, const IR::Inst* nzcv_from_op);
+
+    // Host NZCV liveness across LinkBlockFast
+    /// Conditional blocks may be entered past their NZCV reload when host NZCV already holds the guest's flags.
+    std::unordered_map<IR::LocationDescriptor, CodePtr> nzcv_live_entrypoints;
+    /// LinkBlockFast patch locations that are reached with the guest's flags in host NZCV.
+    std::unordered_set<CodePtr> nzcv_live_patch_locations;
+    bool nzcv_live_at_terminal = false;
 
     struct FastDispatchEntry {
         u64 location_descriptor = 0xFFFF'FFFF'FFFF'FFFFull;
@@ -78,20 +100,27 @@ protected:
     DoNotFastmemMarker GenerateDoNotFastmemMarker(A32EmitContext& ctx, IR::Inst* inst);
     void DoNotFastmem(const DoNotFastmemMarker& marker);
     bool ShouldFastmem(const DoNotFastmemMarker& marker) const;
+    bool ShouldFastmemExclusive() const;
 
     const void* read_memory_8;
     const void* read_memory_16;
     const void* read_memory_32;
     const void* read_memory_64;
+    const void* read_memory_128;
     const void* write_memory_8;
     const void* write_memory_16;
     const void* write_memory_32;
     const void* write_memory_64;
+    const void* write_memory_128;
     void GenMemoryAccessors();
     template<typename T>
-    void ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn);
+    void ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn, bool exclusive = false);
     template<typename T>
     void WriteMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn);
+    template<typename T>
+    void FastmemExclusiveRead(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn);
+    template<typename T>
+    void FastmemExclusiveWrite(A32EmitContext& ctx, IR::Inst* inst, const CodePtr callback_fn);
 
     const void* terminal_handler_pop_rsb_hint;
     const void* terminal_handler_fast_dispatch_hint = nullptr;
@@ -112,9 +141,12 @@ protected:
 
     // Fastmem
     struct FastmemPatchInfo {
+        CodePtr location;
         std::function<void()> callback;
     };
-    std::unordered_map<CodePtr, FastmemPatchInfo> fastmem_patch_info;
+    /// Sorted by location, so that it can be binary searched from the fault handler.
+    std::vector<FastmemPatchInfo> fastmem_patch_info;
+    void AddFastmemPatchInfo(FastmemPatchInfo info);
 
     // Terminal instruction emitters
     void EmitSetUpperLocationDescriptor(IR::LocationDescriptor new_location, IR::LocationDescriptor old_location);
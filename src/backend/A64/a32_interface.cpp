@@ -5,6 +5,7 @@
  */
 
 #include <memory>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
 #include <fmt/format.h>
@@ -25,6 +26,7 @@
 #include "frontend/A32/translate/translate.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/location_descriptor.h"
+#include "ir_opt/pass_manager.h"
 #include "ir_opt/passes.h"
 
 namespace Dynarmic::A32 {
@@ -37,14 +39,45 @@ static RunCodeCallbacks GenRunCodeCallbacks(const A32::UserConfig& config, CodeP
         std::make_unique<ArgCallback>(Devirtualize<&A32::UserCallbacks::AddTicks>(config.callbacks)),
         std::make_unique<ArgCallback>(Devirtualize<&A32::UserCallbacks::GetTicksRemaining>(config.callbacks)),
         reinterpret_cast<u64>(config.fastmem_pointer),
+        A32EmitA64::PinnedRegisters(config),
     };
 }
 
+static Optimization::PassManager GenPassManager(const A32::UserConfig& config) {
+    std::vector<OptimizationPass> pipeline;
+    if (config.enable_optimizations) {
+        pipeline = Optimization::GetPipeline(config.optimization_level, config.optimization_passes);
+    }
+
+    Optimization::PassManager pass_manager{std::move(pipeline), config.record_pass_statistics};
+    pass_manager.Register(OptimizationPass::GetSetElimination, &Optimization::A32GetSetElimination);
+    pass_manager.Register(OptimizationPass::ConstantMemoryReads, [cb = config.callbacks](IR::Block& block) {
+        Optimization::A32ConstantMemoryReads(block, cb);
+    });
+    pass_manager.Register(OptimizationPass::ConstantPropagation, &Optimization::ConstantPropagation);
+    pass_manager.Register(OptimizationPass::Peephole, &Optimization::PeepholePass);
+    pass_manager.Register(OptimizationPass::DeadCodeElimination, &Optimization::DeadCodeElimination);
+    pass_manager.Register(OptimizationPass::Simplification, &Optimization::SimplificationPass);
+    // Memory that is only reachable through the callbacks may be memory-mapped I/O, where repeated reads are observable
+    // and each access must reach the callbacks with the width the guest used.
+    if (config.page_table || config.fastmem_pointer) {
+        pass_manager.Register(OptimizationPass::RedundantLoadElimination, [forward_writes = !config.page_table_attribute_bits](IR::Block& block) {
+            Optimization::A32RedundantLoadElimination(block, forward_writes);
+        });
+        pass_manager.Register(OptimizationPass::MemoryCoalescing, &Optimization::A32MemoryCoalescingPass);
+    }
+    pass_manager.Register(OptimizationPass::MergeInterpretBlocks, [cb = config.callbacks](IR::Block& block) {
+        Optimization::A32MergeInterpretBlocksPass(block, cb);
+    });
+    return pass_manager;
+}
+
 struct Jit::Impl {
     Impl(Jit* jit, A32::UserConfig config)
             : block_of_code(GenRunCodeCallbacks(config, &GetCurrentBlockThunk, this), JitStateInfo{jit_state})
             , emitter(block_of_code, config, jit)
             , config(std::move(config))
+            , pass_manager(GenPassManager(this->config))
             , jit_interface(jit)
     {}
 
@@ -53,6 +86,7 @@ struct Jit::Impl {
     A32EmitA64 emitter;
 
     const A32::UserConfig config;
+    Optimization::PassManager pass_manager;
 
     // Requests made during execution to invalidate the cache are queued up here.
     size_t invalid_cache_generation = 0;
@@ -154,15 +188,10 @@ private:
             PerformCacheInvalidation();
         }
 
-        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, [this](u32 vaddr) { return config.callbacks->MemoryReadCode(vaddr); }, {config.define_unpredictable_behaviour, config.hook_hint_instructions});
-        if (config.enable_optimizations) {
-            Optimization::A32GetSetElimination(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
-            Optimization::A32ConstantMemoryReads(ir_block, config.callbacks);
-            Optimization::ConstantPropagation(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
-            Optimization::A32MergeInterpretBlocksPass(ir_block, config.callbacks);
-        }
+        const auto get_code = [this](u32 vaddr) { return config.callbacks->MemoryReadCode(vaddr); };
+        const auto get_code_page = [this](u32 vaddr) { return config.callbacks->MemoryReadCodePage(vaddr); };
+        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, get_code, {config.define_unpredictable_behaviour, config.hook_hint_instructions}, get_code_page);
+        pass_manager.Run(ir_block);
         Optimization::VerificationPass(ir_block);
         return emitter.Emit(ir_block);
     }
@@ -311,4 +340,12 @@ std::string Jit::Disassemble(const IR::LocationDescriptor& descriptor) {
     return impl->Disassemble(descriptor);
 }
 
+std::vector<PassStatistics> Jit::GetPassStatistics() const {
+    return impl->pass_manager.GetStatistics();
+}
+
+void Jit::ResetPassStatistics() {
+    impl->pass_manager.ResetStatistics();
+}
+
 } // namespace Dynarmic::A32
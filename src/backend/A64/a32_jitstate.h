@@ -57,6 +57,7 @@ struct A32JitState {
     static constexpr u32 RESERVATION_GRANULE_MASK = 0xFFFFFFF8;
     u32 exclusive_state = 0;
     u32 exclusive_address = 0;
+    u64 exclusive_value = 0; // Only used with fastmem_exclusive_access
 
     static constexpr size_t RSBSize = 8; // MUST be a power of 2.
     static constexpr size_t RSBPtrMask = RSBSize - 1;
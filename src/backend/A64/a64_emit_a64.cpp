@@ -0,0 +1,1288 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <dynarmic/A64/exclusive_monitor.h>
+
+#include "backend/A64/a64_emit_a64.h"
+#include "backend/A64/a64_jitstate.h"
+#include "backend/A64/abi.h"
+#include "backend/A64/block_of_code.h"
+#include "backend/A64/devirtualize.h"
+#include "backend/A64/emit_a64.h"
+#include "backend/A64/emitter/a64_emitter.h"
+#include "backend/A64/perf_map.h"
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/common_types.h"
+#include "common/scope_exit.h"
+#include "frontend/A64/location_descriptor.h"
+#include "frontend/A64/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/cond.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/terminal.h"
+
+namespace Dynarmic::BackendA64 {
+
+// Note that unlike the x64 backend these only returns ONLY the offset to register and not the address!
+static size_t MJitStateReg(A64::Reg reg) {
+    return offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(reg);
+}
+
+static size_t MJitStateVec(A64::Vec vec) {
+    return offsetof(A64JitState, vec) + sizeof(u64) * 2 * static_cast<size_t>(vec);
+}
+
+A64EmitContext::A64EmitContext(const A64::UserConfig& conf, RegAlloc& reg_alloc, IR::Block& block)
+    : EmitContext(reg_alloc, block), conf(conf) {}
+
+A64::LocationDescriptor A64EmitContext::Location() const {
+    return A64::LocationDescriptor{block.Location()};
+}
+
+bool A64EmitContext::IsSingleStep() const {
+    return Location().SingleStepping();
+}
+
+FP::RoundingMode A64EmitContext::FPSCR_RMode() const {
+    return Location().FPCR().RMode();
+}
+
+u32 A64EmitContext::FPCR() const {
+    return Location().FPCR().Value();
+}
+
+bool A64EmitContext::FPSCR_FTZ() const {
+    return Location().FPCR().FZ();
+}
+
+bool A64EmitContext::FPSCR_DN() const {
+    return Location().FPCR().DN();
+}
+
+bool A64EmitContext::AccurateNaN() const {
+    return conf.floating_point_nan_accuracy == A64::UserConfig::NaNAccuracy::Accurate;
+}
+
+A64EmitA64::A64EmitA64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_interface)
+    : EmitA64(code), conf(std::move(conf)), jit_interface(jit_interface) {
+    GenMemoryAccessors();
+    GenTerminalHandlers();
+    code.PreludeComplete();
+    ClearFastDispatchTable();
+}
+
+A64EmitA64::~A64EmitA64() = default;
+
+static bool IsSupportedOpcode(IR::Opcode op) {
+    switch (op) {
+#define OPCODE(name, type, ...) case IR::Opcode::name:
+#define A32OPC(...)
+#define A64OPC(name, type, ...) case IR::Opcode::A64##name:
+#include "backend/A64/opcodes.inc"
+#undef OPCODE
+#undef A32OPC
+#undef A64OPC
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Replaces the block with one that hands all of its guest instructions to the interpreter.
+static void ReplaceWithInterpreterFallback(IR::Block& block) {
+    const A64::LocationDescriptor location{block.Location()};
+    const A64::LocationDescriptor end_location{block.EndLocation()};
+
+    IR::Term::Interpret interpret{block.Location()};
+    interpret.num_instructions = static_cast<size_t>((end_location.PC() - location.PC()) / 4);
+
+    IR::Block fallback{block.Location()};
+    fallback.SetEndLocation(block.EndLocation());
+    fallback.CycleCount() = block.CycleCount();
+    fallback.SetTerminal(interpret);
+    block = std::move(fallback);
+}
+
+A64EmitA64::BlockDescriptor A64EmitA64::Emit(IR::Block& block) {
+    // The frontend can emit opcodes this backend does not lower yet; such blocks are interpreted instead.
+    const bool is_supported = std::all_of(block.begin(), block.end(), [](const IR::Inst& inst) {
+        return IsSupportedOpcode(inst.GetOpcode());
+    });
+    if (!is_supported) {
+        ReplaceWithInterpreterFallback(block);
+    }
+
+    code.EnableWriting();
+    SCOPE_EXIT {
+        code.DisableWriting();
+    };
+
+    RegAlloc reg_alloc{code, A64JitState::SpillCount, SpillToOpArg<A64JitState>, any_gpr};
+    A64EmitContext ctx{conf, reg_alloc, block};
+
+    const u8* entrypoint = code.AlignCode16();
+
+    ASSERT(block.GetCondition() == IR::Cond::AL);
+
+    for (auto iter = block.begin(); iter != block.end(); ++iter) {
+        IR::Inst* inst = &*iter;
+
+        // Call the relevant Emit* member function.
+        switch (inst->GetOpcode()) {
+
+#define OPCODE(name, type, ...)                                                  \
+    case IR::Opcode::name:                                                       \
+         A64EmitA64::Emit##name(ctx, inst);                                      \
+         break;
+#define A32OPC(...)
+#define A64OPC(name, type, ...)                                                  \
+    case IR::Opcode::A64##name:                                                  \
+         A64EmitA64::EmitA64##name(ctx, inst);                                   \
+         break;
+#include "backend/A64/opcodes.inc"
+#undef OPCODE
+#undef A32OPC
+#undef A64OPC
+
+        default:
+            ASSERT_FALSE("Invalid opcode: {}", inst->GetOpcode());
+            break;
+        }
+
+        reg_alloc.EndOfAllocScope();
+    }
+
+    reg_alloc.AssertNoMoreUses();
+
+    EmitAddCycles(block.CycleCount());
+    EmitA64::EmitTerminal(block.GetTerminal(), ctx.Location().SetSingleStepping(false), ctx.IsSingleStep());
+    code.BRK(0);
+    code.PatchConstPool();
+    code.FlushIcacheSection(entrypoint, code.GetCodePtr());
+
+    const size_t size = static_cast<size_t>(code.GetCodePtr() - entrypoint);
+
+    const A64::LocationDescriptor descriptor{block.Location()};
+    const A64::LocationDescriptor end_location{block.EndLocation()};
+
+    const auto range = boost::icl::discrete_interval<u64>::closed(descriptor.PC(), end_location.PC() - 1);
+    block_ranges.AddRange(range, descriptor);
+
+    return RegisterBlock(descriptor, entrypoint, size);
+}
+
+void A64EmitA64::ClearCache() {
+    EmitA64::ClearCache();
+    block_ranges.ClearCache();
+    ClearFastDispatchTable();
+}
+
+void A64EmitA64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
+    InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
+}
+
+void A64EmitA64::ClearFastDispatchTable() {
+    if (conf.enable_fast_dispatch) {
+        fast_dispatch_table.fill({});
+    }
+}
+
+void A64EmitA64::GenMemoryAccessors() {
+    code.AlignCode16();
+    read_memory_8 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryRead8>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(read_memory_8, code.GetCodePtr(), "a64_read_memory_8");
+
+    code.AlignCode16();
+    read_memory_16 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryRead16>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(read_memory_16, code.GetCodePtr(), "a64_read_memory_16");
+
+    code.AlignCode16();
+    read_memory_32 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryRead32>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(read_memory_32, code.GetCodePtr(), "a64_read_memory_32");
+
+    code.AlignCode16();
+    read_memory_64 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryRead64>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(read_memory_64, code.GetCodePtr(), "a64_read_memory_64");
+
+    // A64::Vector is returned in X0:X1, the result is left in Q0.
+    code.AlignCode16();
+    read_memory_128 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::Q0);
+    Devirtualize<&A64::UserCallbacks::MemoryRead128>(conf.callbacks).EmitCall(code);
+    code.fp_emitter.FMOV(EncodeRegToDouble(Q0), X0);
+    code.fp_emitter.INS(64, Q0, 1, X1);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::Q0);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(read_memory_128, code.GetCodePtr(), "a64_read_memory_128");
+
+    code.AlignCode16();
+    write_memory_8 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryWrite8>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(write_memory_8, code.GetCodePtr(), "a64_write_memory_8");
+
+    code.AlignCode16();
+    write_memory_16 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryWrite16>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(write_memory_16, code.GetCodePtr(), "a64_write_memory_16");
+
+    code.AlignCode16();
+    write_memory_32 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryWrite32>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(write_memory_32, code.GetCodePtr(), "a64_write_memory_32");
+
+    code.AlignCode16();
+    write_memory_64 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    Devirtualize<&A64::UserCallbacks::MemoryWrite64>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, ABI_RETURN);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(write_memory_64, code.GetCodePtr(), "a64_write_memory_64");
+
+    // The value to write is taken from Q0 and passed to the callback in X2:X3.
+    code.AlignCode16();
+    write_memory_128 = code.GetCodePtr();
+    // Push lr and fp onto the stack
+    code.ABI_PushRegisters(0x60000000);
+    code.ADD(X29, SP, 0);
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    code.fp_emitter.UMOV(64, code.ABI_PARAM3, Q0, 0);
+    code.fp_emitter.UMOV(64, code.ABI_PARAM4, Q0, 1);
+    Devirtualize<&A64::UserCallbacks::MemoryWrite128>(conf.callbacks).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code.ABI_PopRegisters(0x60000000);
+    code.RET();
+    PerfMapRegister(write_memory_128, code.GetCodePtr(), "a64_write_memory_128");
+}
+
+void A64EmitA64::GenTerminalHandlers() {
+    const ARM64Reg fast_dispatch_entry_reg = X19;
+    const ARM64Reg location_descriptor_reg = X20;
+
+    // PC ends up in fast_dispatch_entry_reg, location_descriptor ends up in location_descriptor_reg.
+    const auto calculate_location_descriptor = [this, fast_dispatch_entry_reg, location_descriptor_reg] {
+        // This calculation has to match up with A64::LocationDescriptor::UniqueHash
+        // TODO: Optimization is available here based on known state of fpcr.
+        code.LDR(INDEX_UNSIGNED, fast_dispatch_entry_reg, X28, offsetof(A64JitState, pc));
+        code.ANDI2R(location_descriptor_reg, fast_dispatch_entry_reg, A64::LocationDescriptor::pc_mask);
+        code.LDR(INDEX_UNSIGNED, DecodeReg(code.ABI_SCRATCH1), X28, offsetof(A64JitState, fpcr));
+        code.ANDI2R(DecodeReg(code.ABI_SCRATCH1), DecodeReg(code.ABI_SCRATCH1), A64::LocationDescriptor::fpcr_mask, W8);
+        code.ORR(location_descriptor_reg, location_descriptor_reg, code.ABI_SCRATCH1, ArithOption{code.ABI_SCRATCH1, ST_LSL, A64::LocationDescriptor::fpcr_shift});
+    };
+
+    FixupBranch fast_dispatch_cache_miss, rsb_cache_miss;
+
+    code.AlignCode16();
+    terminal_handler_pop_rsb_hint = code.GetCodePtr();
+    calculate_location_descriptor();
+    code.LDR(INDEX_UNSIGNED, DecodeReg(code.ABI_SCRATCH1), X28, offsetof(A64JitState, rsb_ptr));
+    code.SUBI2R(code.ABI_SCRATCH1, DecodeReg(code.ABI_SCRATCH1), 1);
+    code.ANDI2R(code.ABI_SCRATCH1, DecodeReg(code.ABI_SCRATCH1), u32(A64JitState::RSBPtrMask));
+    code.STR(INDEX_UNSIGNED, DecodeReg(code.ABI_SCRATCH1), X28, offsetof(A64JitState, rsb_ptr));
+
+    code.ADD(code.ABI_SCRATCH1, X28, code.ABI_SCRATCH1, ArithOption{code.ABI_SCRATCH1, ST_LSL, 3});
+    code.LDR(INDEX_UNSIGNED, X8, code.ABI_SCRATCH1, offsetof(A64JitState, rsb_location_descriptors));
+    code.CMP(location_descriptor_reg, X8);
+    if (conf.enable_fast_dispatch) {
+        rsb_cache_miss = code.B(CC_NEQ);
+    } else {
+        code.B(CC_NEQ, code.GetReturnFromRunCodeAddress());
+    }
+    code.LDR(INDEX_UNSIGNED, code.ABI_SCRATCH1, code.ABI_SCRATCH1, offsetof(A64JitState, rsb_codeptrs));
+    code.BR(code.ABI_SCRATCH1);
+    PerfMapRegister(terminal_handler_pop_rsb_hint, code.GetCodePtr(), "a64_terminal_handler_pop_rsb_hint");
+
+    if (conf.enable_fast_dispatch) {
+        terminal_handler_fast_dispatch_hint = code.AlignCode16();
+        calculate_location_descriptor();
+        code.SetJumpTarget(rsb_cache_miss);
+        code.MOVI2R(code.ABI_SCRATCH1, reinterpret_cast<u64>(fast_dispatch_table.data()));
+        code.CRC32CW(DecodeReg(fast_dispatch_entry_reg), DecodeReg(fast_dispatch_entry_reg), DecodeReg(code.ABI_SCRATCH1));
+        code.ANDI2R(fast_dispatch_entry_reg, fast_dispatch_entry_reg, fast_dispatch_table_mask);
+        code.ADD(fast_dispatch_entry_reg, fast_dispatch_entry_reg, code.ABI_SCRATCH1);
+
+        code.LDR(INDEX_UNSIGNED, code.ABI_SCRATCH1, fast_dispatch_entry_reg, offsetof(FastDispatchEntry, location_descriptor));
+        code.CMP(location_descriptor_reg, code.ABI_SCRATCH1);
+        fast_dispatch_cache_miss = code.B(CC_NEQ);
+        code.LDR(INDEX_UNSIGNED, code.ABI_SCRATCH1, fast_dispatch_entry_reg, offsetof(FastDispatchEntry, code_ptr));
+        code.BR(code.ABI_SCRATCH1);
+
+        code.SetJumpTarget(fast_dispatch_cache_miss);
+        code.STR(INDEX_UNSIGNED, location_descriptor_reg, fast_dispatch_entry_reg, offsetof(FastDispatchEntry, location_descriptor));
+        code.LookupBlock();
+        code.STR(INDEX_UNSIGNED, code.ABI_RETURN, fast_dispatch_entry_reg, offsetof(FastDispatchEntry, code_ptr));
+        code.BR(code.ABI_RETURN);
+        PerfMapRegister(terminal_handler_fast_dispatch_hint, code.GetCodePtr(), "a64_terminal_handler_fast_dispatch_hint");
+
+        code.AlignCode16();
+        fast_dispatch_table_lookup = reinterpret_cast<FastDispatchEntry& (*)(u64)>(code.GetWritableCodePtr());
+        code.MOVI2R(code.ABI_PARAM2, reinterpret_cast<u64>(fast_dispatch_table.data()));
+        code.CRC32CW(DecodeReg(code.ABI_PARAM1), DecodeReg(code.ABI_PARAM1), DecodeReg(code.ABI_PARAM2));
+        code.ANDI2R(DecodeReg(code.ABI_PARAM1), DecodeReg(code.ABI_PARAM1), fast_dispatch_table_mask);
+        code.ADD(code.ABI_RETURN, code.ABI_PARAM1, code.ABI_PARAM2);
+        code.RET();
+    }
+}
+
+void A64EmitA64::EmitPushRSB(EmitContext& ctx, IR::Inst* inst) {
+    if (!conf.enable_optimizations) {
+        return;
+    }
+
+    EmitA64::EmitPushRSB(ctx, inst);
+}
+
+void A64EmitA64::EmitA64SetCheckBit(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg to_store = DecodeReg(ctx.reg_alloc.UseGpr(args[0]));
+    code.STRB(INDEX_UNSIGNED, to_store, X28, offsetof(A64JitState, check_bit));
+}
+
+void A64EmitA64::EmitA64GetCFlag(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A64JitState, cpsr_nzcv));
+    code.UBFX(result, result, 29, 1);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetNZCVRaw(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg nzcv_raw = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    code.LDR(INDEX_UNSIGNED, nzcv_raw, X28, offsetof(A64JitState, cpsr_nzcv));
+    ctx.reg_alloc.DefineValue(inst, nzcv_raw);
+}
+
+void A64EmitA64::EmitA64SetNZCVRaw(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg nzcv_raw = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[0]));
+
+    code.ANDI2R(nzcv_raw, nzcv_raw, 0xF0000000);
+    code.STR(INDEX_UNSIGNED, nzcv_raw, X28, offsetof(A64JitState, cpsr_nzcv));
+}
+
+void A64EmitA64::EmitA64SetNZCV(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitA64SetNZCVRaw(ctx, inst);
+}
+
+void A64EmitA64::EmitA64GetW(A64EmitContext& ctx, IR::Inst* inst) {
+    const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
+    const ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
+
+    code.LDR(INDEX_UNSIGNED, result, X28, MJitStateReg(reg));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetX(A64EmitContext& ctx, IR::Inst* inst) {
+    const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
+    const ARM64Reg result = ctx.reg_alloc.ScratchGpr();
+
+    code.LDR(INDEX_UNSIGNED, result, X28, MJitStateReg(reg));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetS(A64EmitContext& ctx, IR::Inst* inst) {
+    const A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.LDR(32, INDEX_UNSIGNED, result, X28, MJitStateVec(vec));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetD(A64EmitContext& ctx, IR::Inst* inst) {
+    const A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.LDR(64, INDEX_UNSIGNED, result, X28, MJitStateVec(vec));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetQ(A64EmitContext& ctx, IR::Inst* inst) {
+    const A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.LDR(128, INDEX_UNSIGNED, result, X28, MJitStateVec(vec));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetSP(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = ctx.reg_alloc.ScratchGpr();
+    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A64JitState, sp));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetFPCR(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    code.LDR(INDEX_UNSIGNED, result, X28, offsetof(A64JitState, fpcr));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+static u32 GetFPSRImpl(A64JitState* jit_state) {
+    return jit_state->GetFpsr();
+}
+
+void A64EmitA64::EmitA64GetFPSR(A64EmitContext& ctx, IR::Inst* inst) {
+    ctx.reg_alloc.HostCall(inst);
+    // Use an unused HostCall register
+    const ARM64Reg fpsr = X9;
+    code.MOV(code.ABI_PARAM1, X28);
+
+    code.MRS(fpsr, FIELD_FPSR);
+    code.STR(INDEX_UNSIGNED, fpsr, X28, offsetof(A64JitState, guest_fpsr));
+    code.QuickCallFunction(&GetFPSRImpl);
+}
+
+void A64EmitA64::EmitA64SetW(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
+    // Writes to W registers zero the upper half of the X register.
+    const ARM64Reg to_store = ctx.reg_alloc.UseScratchGpr(args[1]);
+    code.MOV(DecodeReg(to_store), DecodeReg(to_store));
+    code.STR(INDEX_UNSIGNED, to_store, X28, MJitStateReg(reg));
+}
+
+void A64EmitA64::EmitA64SetX(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
+    if (args[1].IsInFpr()) {
+        const ARM64Reg to_store = ctx.reg_alloc.UseFpr(args[1]);
+        code.fp_emitter.STR(64, INDEX_UNSIGNED, to_store, X28, MJitStateReg(reg));
+    } else {
+        const ARM64Reg to_store = ctx.reg_alloc.UseGpr(args[1]);
+        code.STR(INDEX_UNSIGNED, to_store, X28, MJitStateReg(reg));
+    }
+}
+
+void A64EmitA64::EmitA64SetS(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    const ARM64Reg to_store = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg tmp = ctx.reg_alloc.ScratchFpr();
+
+    // Scalar writes zero the rest of the vector register.
+    code.fp_emitter.FMOV(EncodeRegToSingle(tmp), EncodeRegToSingle(to_store));
+    code.fp_emitter.STR(128, INDEX_UNSIGNED, tmp, X28, MJitStateVec(vec));
+}
+
+void A64EmitA64::EmitA64SetD(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    const ARM64Reg to_store = ctx.reg_alloc.UseScratchFpr(args[1]);
+
+    // Scalar writes zero the rest of the vector register.
+    code.fp_emitter.FMOV(EncodeRegToDouble(to_store), EncodeRegToDouble(to_store));
+    code.fp_emitter.STR(128, INDEX_UNSIGNED, to_store, X28, MJitStateVec(vec));
+}
+
+void A64EmitA64::EmitA64SetQ(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    const ARM64Reg to_store = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.STR(128, INDEX_UNSIGNED, to_store, X28, MJitStateVec(vec));
+}
+
+void A64EmitA64::EmitA64SetSP(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    if (args[0].IsInFpr()) {
+        const ARM64Reg to_store = ctx.reg_alloc.UseFpr(args[0]);
+        code.fp_emitter.STR(64, INDEX_UNSIGNED, to_store, X28, offsetof(A64JitState, sp));
+    } else {
+        const ARM64Reg to_store = ctx.reg_alloc.UseGpr(args[0]);
+        code.STR(INDEX_UNSIGNED, to_store, X28, offsetof(A64JitState, sp));
+    }
+}
+
+static void SetFPCRImpl(A64JitState* jit_state, u32 value) {
+    jit_state->SetFpcr(value);
+}
+
+void A64EmitA64::EmitA64SetFPCR(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    // Use an unused HostCall register
+    const ARM64Reg fpcr = X9;
+
+    code.MOV(code.ABI_PARAM1, X28);
+    code.QuickCallFunction(&SetFPCRImpl);
+
+    code.LDR(INDEX_UNSIGNED, fpcr, X28, offsetof(A64JitState, guest_fpcr));
+    code._MSR(FIELD_FPCR, fpcr);
+}
+
+static void SetFPSRImpl(A64JitState* jit_state, u32 value) {
+    jit_state->SetFpsr(value);
+}
+
+void A64EmitA64::EmitA64SetFPSR(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    // Use an unused HostCall register
+    const ARM64Reg fpsr = X9;
+
+    code.MOV(code.ABI_PARAM1, X28);
+    code.QuickCallFunction(&SetFPSRImpl);
+
+    code.LDR(INDEX_UNSIGNED, fpsr, X28, offsetof(A64JitState, guest_fpsr));
+    code._MSR(FIELD_FPSR, fpsr);
+}
+
+void A64EmitA64::EmitA64OrQC(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (args[0].IsImmediate()) {
+        if (!args[0].GetImmediateU1()) {
+            return;
+        }
+
+        const ARM64Reg to_store = DecodeReg(ctx.reg_alloc.ScratchGpr());
+        code.MOVI2R(to_store, 1);
+        code.STR(INDEX_UNSIGNED, to_store, X28, offsetof(A64JitState, fpsr_qc));
+        return;
+    }
+
+    const ARM64Reg to_store = DecodeReg(ctx.reg_alloc.UseGpr(args[0]));
+    const ARM64Reg scratch = DecodeReg(ctx.reg_alloc.ScratchGpr());
+
+    code.LDR(INDEX_UNSIGNED, scratch, X28, offsetof(A64JitState, fpsr_qc));
+    code.ORR(scratch, scratch, to_store);
+    code.STR(INDEX_UNSIGNED, scratch, X28, offsetof(A64JitState, fpsr_qc));
+}
+
+void A64EmitA64::EmitA64SetPC(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    if (args[0].IsInFpr()) {
+        const ARM64Reg to_store = ctx.reg_alloc.UseFpr(args[0]);
+        code.fp_emitter.STR(64, INDEX_UNSIGNED, to_store, X28, offsetof(A64JitState, pc));
+    } else {
+        const ARM64Reg to_store = ctx.reg_alloc.UseGpr(args[0]);
+        code.STR(INDEX_UNSIGNED, to_store, X28, offsetof(A64JitState, pc));
+    }
+}
+
+void A64EmitA64::EmitA64CallSupervisor(A64EmitContext& ctx, IR::Inst* inst) {
+    ctx.reg_alloc.HostCall(nullptr);
+
+    code.SwitchFpscrOnExit();
+    code.LDR(INDEX_UNSIGNED, code.ABI_PARAM2, X28, offsetof(A64JitState, cycles_to_run));
+    code.SUB(code.ABI_PARAM2, code.ABI_PARAM2, X26);
+
+    Devirtualize<&A64::UserCallbacks::AddTicks>(conf.callbacks).EmitCall(code);
+    ctx.reg_alloc.EndOfAllocScope();
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[0].IsImmediate());
+    const u32 imm = args[0].GetImmediateU32();
+    ctx.reg_alloc.HostCall(nullptr);
+    Devirtualize<&A64::UserCallbacks::CallSVC>(conf.callbacks).EmitCall(code, [&](RegList param) {
+        code.MOVI2R(param[0], imm);
+    });
+    Devirtualize<&A64::UserCallbacks::GetTicksRemaining>(conf.callbacks).EmitCall(code);
+    code.STR(INDEX_UNSIGNED, code.ABI_RETURN, X28, offsetof(A64JitState, cycles_to_run));
+    code.MOV(X26, code.ABI_RETURN);
+    code.SwitchFpscrOnEntry();
+
+    // The kernel would have to execute ERET to get here, which would clear exclusive state.
+    code.STRB(INDEX_UNSIGNED, WZR, X28, offsetof(A64JitState, exclusive_state));
+}
+
+void A64EmitA64::EmitA64ExceptionRaised(A64EmitContext& ctx, IR::Inst* inst) {
+    ctx.reg_alloc.HostCall(nullptr);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[0].IsImmediate() && args[1].IsImmediate());
+    const u64 pc = args[0].GetImmediateU64();
+    const u64 exception = args[1].GetImmediateU64();
+    Devirtualize<&A64::UserCallbacks::ExceptionRaised>(conf.callbacks).EmitCall(code, [&](RegList param) {
+        code.MOVI2R(param[0], pc);
+        code.MOVI2R(param[1], exception);
+    });
+}
+
+void A64EmitA64::EmitA64DataCacheOperationRaised(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    Devirtualize<&A64::UserCallbacks::DataCacheOperationRaised>(conf.callbacks).EmitCall(code);
+}
+
+void A64EmitA64::EmitA64DataSynchronizationBarrier(A64EmitContext&, IR::Inst*) {
+    code.DSB(ISH);
+}
+
+void A64EmitA64::EmitA64DataMemoryBarrier(A64EmitContext&, IR::Inst*) {
+    code.DMB(ISH);
+}
+
+static void ClearCacheImpl(A64::Jit* jit) {
+    jit->ClearCache();
+}
+
+void A64EmitA64::EmitA64InstructionSynchronizationBarrier(A64EmitContext& ctx, IR::Inst*) {
+    ctx.reg_alloc.HostCall(nullptr);
+
+    code.MOVP2R(code.ABI_PARAM1, jit_interface);
+    code.QuickCallFunction(&ClearCacheImpl);
+}
+
+void A64EmitA64::EmitA64OrderedAccessBarrier(A64EmitContext&, IR::Inst*) {
+    code.DMB(ISH);
+}
+
+void A64EmitA64::EmitA64GetCNTFRQ(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    code.MOVI2R(result, conf.cntfrq_el0);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetCNTPCT(A64EmitContext& ctx, IR::Inst* inst) {
+    ctx.reg_alloc.HostCall(inst);
+    if (!conf.wall_clock_cntpct) {
+        code.UpdateTicks();
+    }
+    Devirtualize<&A64::UserCallbacks::GetCNTPCT>(conf.callbacks).EmitCall(code);
+}
+
+void A64EmitA64::EmitA64GetCTR(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    code.MOVI2R(result, conf.ctr_el0);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetDCZID(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = DecodeReg(ctx.reg_alloc.ScratchGpr());
+    code.MOVI2R(result, conf.dczid_el0);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetTPIDR(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = ctx.reg_alloc.ScratchGpr();
+    if (conf.tpidr_el0) {
+        code.MOVP2R(result, conf.tpidr_el0);
+        code.LDR(INDEX_UNSIGNED, result, result, 0);
+    } else {
+        code.MOVI2R(result, 0);
+    }
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64GetTPIDRRO(A64EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg result = ctx.reg_alloc.ScratchGpr();
+    if (conf.tpidrro_el0) {
+        code.MOVP2R(result, conf.tpidrro_el0);
+        code.LDR(INDEX_UNSIGNED, result, result, 0);
+    } else {
+        code.MOVI2R(result, 0);
+    }
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::EmitA64SetTPIDR(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg value = ctx.reg_alloc.UseGpr(args[0]);
+    const ARM64Reg addr = ctx.reg_alloc.ScratchGpr();
+    if (conf.tpidr_el0) {
+        code.MOVP2R(addr, conf.tpidr_el0);
+        code.STR(INDEX_UNSIGNED, value, addr, 0);
+    }
+}
+
+void A64EmitA64::EmitA64ClearExclusive(A64EmitContext&, IR::Inst*) {
+    code.STRB(INDEX_UNSIGNED, WZR, X28, offsetof(A64JitState, exclusive_state));
+}
+
+namespace {
+
+constexpr size_t page_bits = 12;
+constexpr size_t page_size = 1 << page_bits;
+
+// Number of page index bits indexed by a given level of a multi-level page table.
+// See A64::UserConfig::page_table_levels for a description of the layout.
+size_t PageTableLevelBits(const A64::UserConfig& conf, size_t level) {
+    const size_t valid_page_index_bits = conf.page_table_address_space_bits - page_bits;
+    const size_t lower_level_bits = valid_page_index_bits / conf.page_table_levels;
+    if (level == 0) {
+        return valid_page_index_bits - lower_level_bits * (conf.page_table_levels - 1);
+    }
+    return lower_level_bits;
+}
+
+} // anonymous namespace
+
+// Leaves the host address of vaddr in page. Accesses that cannot be done directly are sent to abort.
+void A64EmitA64::EmitPageTableLookup(A64EmitContext& ctx, size_t bitsize, bool is_write, std::vector<FixupBranch>& abort, ARM64Reg vaddr, ARM64Reg page, ARM64Reg tmp) {
+    if (bitsize != 8 && (ctx.conf.detect_misaligned_access_via_page_table & bitsize) != 0) {
+        const u32 align_mask = static_cast<u32>(bitsize / 8 - 1);
+
+        code.TSTI2R(vaddr, align_mask);
+        if (!ctx.conf.only_detect_misalignment_via_page_table_on_page_boundary) {
+            abort.push_back(code.B(CC_NEQ));
+        } else {
+            const u32 page_align_mask = static_cast<u32>(page_size - 1) & ~align_mask;
+
+            FixupBranch aligned = code.B(CC_EQ);
+            code.ANDI2R(tmp, vaddr, page_align_mask);
+            code.CMPI2R(tmp, page_align_mask);
+            abort.push_back(code.B(CC_EQ));
+            code.SetJumpTarget(aligned);
+        }
+    }
+
+    const size_t unused_top_bits = 64 - ctx.conf.page_table_address_space_bits;
+    if (unused_top_bits != 0 && !ctx.conf.silently_mirror_page_table) {
+        code.LSR(tmp, vaddr, static_cast<int>(ctx.conf.page_table_address_space_bits));
+        abort.push_back(code.CBNZ(tmp));
+    }
+
+    code.MOVP2R(page, ctx.conf.page_table);
+
+    size_t shift = ctx.conf.page_table_address_space_bits;
+    for (size_t level = 0; level < ctx.conf.page_table_levels; level++) {
+        const size_t level_bits = PageTableLevelBits(ctx.conf, level);
+        shift -= level_bits;
+
+        code.UBFX(tmp, vaddr, static_cast<int>(shift), static_cast<int>(level_bits));
+        code.LDR(page, page, ArithOption{tmp, true});
+        if (level + 1 != ctx.conf.page_table_levels) {
+            abort.push_back(code.CBZ(page));
+        }
+    }
+
+    // Writes to pages with attribute bits set are sent to abort.
+    if (ctx.conf.page_table_attribute_bits) {
+        if (is_write) {
+            code.TSTI2R(page, A64::UserConfig::PAGE_ATTRIBUTE_MASK);
+            abort.push_back(code.B(CC_NEQ));
+        }
+        code.ANDI2R(page, page, ~u64(A64::UserConfig::PAGE_ATTRIBUTE_MASK));
+    }
+    abort.push_back(code.CBZ(page));
+
+    if (ctx.conf.absolute_offset_page_table) {
+        code.ADD(page, page, vaddr);
+    } else {
+        code.ANDI2R(tmp, vaddr, page_size - 1);
+        code.ADD(page, page, tmp);
+    }
+}
+
+void A64EmitA64::ReadMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize, const CodePtr callback_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    ctx.reg_alloc.ScratchGpr({ABI_RETURN});
+
+    // The 128-bit callback thunk leaves its result in Q0.
+    const ARM64Reg result = bitsize == 128 ? ctx.reg_alloc.ScratchFpr({HostLoc::Q0}) : ctx.reg_alloc.ScratchGpr();
+    const ARM64Reg vaddr = code.ABI_PARAM2;
+    const ARM64Reg tmp = code.ABI_RETURN;
+
+    if (!conf.page_table) {
+        code.BL(callback_fn);
+        if (bitsize != 128) {
+            code.MOV(result, code.ABI_RETURN);
+        }
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const ARM64Reg page = bitsize == 128 ? ctx.reg_alloc.ScratchGpr() : result;
+
+    std::vector<FixupBranch> abort;
+    EmitPageTableLookup(ctx, bitsize, false, abort, vaddr, page, tmp);
+    switch (bitsize) {
+    case 8:
+        code.LDRB(INDEX_UNSIGNED, DecodeReg(result), page, 0);
+        break;
+    case 16:
+        code.LDRH(INDEX_UNSIGNED, DecodeReg(result), page, 0);
+        break;
+    case 32:
+        code.LDR(INDEX_UNSIGNED, DecodeReg(result), page, 0);
+        break;
+    case 64:
+        code.LDR(INDEX_UNSIGNED, result, page, 0);
+        break;
+    case 128:
+        code.fp_emitter.LDR(128, INDEX_UNSIGNED, result, page, 0);
+        break;
+    default:
+        ASSERT_FALSE("Invalid bitsize");
+        break;
+    }
+    FixupBranch end = code.B();
+
+    for (FixupBranch a : abort) {
+        code.SetJumpTarget(a);
+    }
+    code.BL(callback_fn);
+    if (bitsize != 128) {
+        code.MOV(result, code.ABI_RETURN);
+    }
+    code.SetJumpTarget(end);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitA64::WriteMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize, const CodePtr callback_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({ABI_RETURN});
+    ctx.reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    // The 128-bit callback thunk takes its value from Q0.
+    if (bitsize == 128) {
+        ctx.reg_alloc.Use(args[1], HostLoc::Q0);
+    } else {
+        ctx.reg_alloc.UseScratch(args[1], ABI_PARAM3);
+    }
+
+    const ARM64Reg vaddr = code.ABI_PARAM2;
+    const ARM64Reg value = bitsize == 128 ? Q0 : code.ABI_PARAM3;
+    const ARM64Reg tmp = code.ABI_RETURN;
+
+    if (!conf.page_table) {
+        code.BL(callback_fn);
+        return;
+    }
+
+    const ARM64Reg page = ctx.reg_alloc.ScratchGpr();
+
+    std::vector<FixupBranch> abort;
+    EmitPageTableLookup(ctx, bitsize, true, abort, vaddr, page, tmp);
+    switch (bitsize) {
+    case 8:
+        code.STRB(INDEX_UNSIGNED, DecodeReg(value), page, 0);
+        break;
+    case 16:
+        code.STRH(INDEX_UNSIGNED, DecodeReg(value), page, 0);
+        break;
+    case 32:
+        code.STR(INDEX_UNSIGNED, DecodeReg(value), page, 0);
+        break;
+    case 64:
+        code.STR(INDEX_UNSIGNED, value, page, 0);
+        break;
+    case 128:
+        code.fp_emitter.STR(128, INDEX_UNSIGNED, value, page, 0);
+        break;
+    default:
+        ASSERT_FALSE("Invalid bitsize");
+        break;
+    }
+    FixupBranch end = code.B();
+
+    for (FixupBranch a : abort) {
+        code.SetJumpTarget(a);
+    }
+    code.BL(callback_fn);
+    code.SetJumpTarget(end);
+}
+
+void A64EmitA64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    ReadMemory(ctx, inst, 8, read_memory_8);
+}
+
+void A64EmitA64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    ReadMemory(ctx, inst, 16, read_memory_16);
+}
+
+void A64EmitA64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    ReadMemory(ctx, inst, 32, read_memory_32);
+}
+
+void A64EmitA64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    ReadMemory(ctx, inst, 64, read_memory_64);
+}
+
+void A64EmitA64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    ReadMemory(ctx, inst, 128, read_memory_128);
+}
+
+void A64EmitA64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    WriteMemory(ctx, inst, 8, write_memory_8);
+}
+
+void A64EmitA64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    WriteMemory(ctx, inst, 16, write_memory_16);
+}
+
+void A64EmitA64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    WriteMemory(ctx, inst, 32, write_memory_32);
+}
+
+void A64EmitA64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    WriteMemory(ctx, inst, 64, write_memory_64);
+}
+
+void A64EmitA64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    WriteMemory(ctx, inst, 128, write_memory_128);
+}
+
+template <typename T, T (A64::UserCallbacks::*fn)(A64::VAddr)>
+static T ExclusiveReadMemoryImpl(A64::UserConfig& conf, u64 vaddr) {
+    return conf.global_monitor->ReadAndMark<T>(conf.processor_id, vaddr, [&]() -> T {
+        return (conf.callbacks->*fn)(vaddr);
+    });
+}
+
+template <typename T, T (A64::UserCallbacks::*fn)(A64::VAddr)>
+static void ExclusiveRead(BlockOfCode& code, RegAlloc& reg_alloc, IR::Inst* inst, A64::UserConfig& conf) {
+    ASSERT(conf.global_monitor != nullptr);
+    auto args = reg_alloc.GetArgumentInfo(inst);
+    reg_alloc.HostCall(inst, {}, args[0]);
+    // Use an unused HostCall register
+    const ARM64Reg state = W9;
+
+    code.MOVI2R(state, u8(1));
+    code.STRB(INDEX_UNSIGNED, state, X28, offsetof(A64JitState, exclusive_state));
+    code.MOVP2R(code.ABI_PARAM1, &conf);
+    code.QuickCallFunction(&ExclusiveReadMemoryImpl<T, fn>);
+}
+
+void A64EmitA64::EmitA64ExclusiveReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveRead<u8, &A64::UserCallbacks::MemoryRead8>(code, ctx.reg_alloc, inst, conf);
+}
+
+void A64EmitA64::EmitA64ExclusiveReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveRead<u16, &A64::UserCallbacks::MemoryRead16>(code, ctx.reg_alloc, inst, conf);
+}
+
+void A64EmitA64::EmitA64ExclusiveReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveRead<u32, &A64::UserCallbacks::MemoryRead32>(code, ctx.reg_alloc, inst, conf);
+}
+
+void A64EmitA64::EmitA64ExclusiveReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveRead<u64, &A64::UserCallbacks::MemoryRead64>(code, ctx.reg_alloc, inst, conf);
+}
+
+void A64EmitA64::EmitA64ExclusiveReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    ASSERT(conf.global_monitor != nullptr);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ctx.reg_alloc.Use(args[0], ABI_PARAM2);
+    ctx.reg_alloc.EndOfAllocScope();
+    ctx.reg_alloc.HostCall(nullptr);
+    // Use an unused HostCall register
+    const ARM64Reg state = W9;
+
+    code.MOVI2R(state, u8(1));
+    code.STRB(INDEX_UNSIGNED, state, X28, offsetof(A64JitState, exclusive_state));
+    code.MOVP2R(code.ABI_PARAM1, &conf);
+    code.QuickCallFunction(&ExclusiveReadMemoryImpl<A64::Vector, &A64::UserCallbacks::MemoryRead128>);
+
+    // A64::Vector is returned in X0:X1.
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+    code.fp_emitter.FMOV(EncodeRegToDouble(result), code.ABI_RETURN);
+    code.fp_emitter.INS(64, result, 1, code.ABI_PARAM2);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <typename T, bool (A64::UserCallbacks::*fn)(A64::VAddr, T, T)>
+static u32 ExclusiveWriteMemoryImpl(A64::UserConfig& conf, u64 vaddr, T value) {
+    return conf.global_monitor->DoExclusiveOperation<T>(conf.processor_id, vaddr, [&](T expected) -> bool {
+        return (conf.callbacks->*fn)(vaddr, value, expected);
+    }) ? 0 : 1;
+}
+
+void A64EmitA64::EmitExclusiveWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
+    ASSERT(conf.global_monitor != nullptr);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (bitsize != 128) {
+        ctx.reg_alloc.HostCall(inst, {}, args[0], args[1]);
+    } else {
+        ctx.reg_alloc.Use(args[0], ABI_PARAM2);
+        ctx.reg_alloc.Use(args[1], HostLoc::Q0);
+        ctx.reg_alloc.EndOfAllocScope();
+        ctx.reg_alloc.HostCall(inst);
+    }
+    // Use an unused HostCall register
+    const ARM64Reg state = W9;
+
+    code.MOVI2R(DecodeReg(code.ABI_RETURN), u32(1));
+    code.LDRB(INDEX_UNSIGNED, state, X28, offsetof(A64JitState, exclusive_state));
+    FixupBranch end = code.CBZ(state);
+    code.STRB(INDEX_UNSIGNED, WZR, X28, offsetof(A64JitState, exclusive_state));
+    code.MOVP2R(code.ABI_PARAM1, &conf);
+    switch (bitsize) {
+    case 8:
+        code.QuickCallFunction(&ExclusiveWriteMemoryImpl<u8, &A64::UserCallbacks::MemoryWriteExclusive8>);
+        break;
+    case 16:
+        code.QuickCallFunction(&ExclusiveWriteMemoryImpl<u16, &A64::UserCallbacks::MemoryWriteExclusive16>);
+        break;
+    case 32:
+        code.QuickCallFunction(&ExclusiveWriteMemoryImpl<u32, &A64::UserCallbacks::MemoryWriteExclusive32>);
+        break;
+    case 64:
+        code.QuickCallFunction(&ExclusiveWriteMemoryImpl<u64, &A64::UserCallbacks::MemoryWriteExclusive64>);
+        break;
+    case 128:
+        // A64::Vector is passed in X2:X3.
+        code.fp_emitter.UMOV(64, code.ABI_PARAM3, Q0, 0);
+        code.fp_emitter.UMOV(64, code.ABI_PARAM4, Q0, 1);
+        code.QuickCallFunction(&ExclusiveWriteMemoryImpl<A64::Vector, &A64::UserCallbacks::MemoryWriteExclusive128>);
+        break;
+    default:
+        UNREACHABLE();
+    }
+    code.SetJumpTarget(end);
+}
+
+void A64EmitA64::EmitA64ExclusiveWriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitExclusiveWrite(ctx, inst, 8);
+}
+
+void A64EmitA64::EmitA64ExclusiveWriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitExclusiveWrite(ctx, inst, 16);
+}
+
+void A64EmitA64::EmitA64ExclusiveWriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitExclusiveWrite(ctx, inst, 32);
+}
+
+void A64EmitA64::EmitA64ExclusiveWriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitExclusiveWrite(ctx, inst, 64);
+}
+
+void A64EmitA64::EmitA64ExclusiveWriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitExclusiveWrite(ctx, inst, 128);
+}
+
+std::string A64EmitA64::LocationDescriptorToFriendlyName(const IR::LocationDescriptor& ir_descriptor) const {
+    const A64::LocationDescriptor descriptor{ir_descriptor};
+    return fmt::format("a64_{:016X}_fpcr{:08X}", descriptor.PC(), descriptor.FPCR().Value());
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor, bool) {
+    code.MOVI2R(code.ABI_PARAM2, A64::LocationDescriptor{terminal.next}.PC());
+    code.MOVI2R(DecodeReg(code.ABI_PARAM3), terminal.num_instructions);
+    code.STR(INDEX_UNSIGNED, code.ABI_PARAM2, X28, offsetof(A64JitState, pc));
+    code.SwitchFpscrOnExit();
+    Devirtualize<&A64::UserCallbacks::InterpreterFallback>(conf.callbacks).EmitCall(code);
+    code.ReturnFromRunCode(true);
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::ReturnToDispatch, IR::LocationDescriptor, bool) {
+    code.ReturnFromRunCode();
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::LinkBlock terminal, IR::LocationDescriptor, bool is_single_step) {
+    if (!conf.enable_optimizations || is_single_step) {
+        code.MOVI2R(code.ABI_SCRATCH1, A64::LocationDescriptor{terminal.next}.PC());
+        code.STR(INDEX_UNSIGNED, code.ABI_SCRATCH1, X28, offsetof(A64JitState, pc));
+        code.ReturnFromRunCode();
+        return;
+    }
+
+    code.CMP(X26, ZR);
+
+    patch_information[terminal.next].jg.emplace_back(code.GetCodePtr());
+    if (auto next_bb = GetBasicBlock(terminal.next)) {
+        EmitPatchJg(terminal.next, next_bb->entrypoint);
+    } else {
+        EmitPatchJg(terminal.next);
+    }
+    FixupBranch dest = code.B();
+
+    code.SwitchToFarCode();
+    code.AlignCode16();
+    code.SetJumpTarget(dest);
+    code.MOVI2R(code.ABI_SCRATCH1, A64::LocationDescriptor{terminal.next}.PC());
+    code.STR(INDEX_UNSIGNED, code.ABI_SCRATCH1, X28, offsetof(A64JitState, pc));
+    PushRSBHelper(X1, X2, terminal.next);
+    code.ForceReturnFromRunCode();
+
+    //Todo: find a better/generic place to FlushIcache when switching between
+    //      far code and near code
+    code.FlushIcache();
+    code.SwitchToNearCode();
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::LinkBlockFast terminal, IR::LocationDescriptor, bool is_single_step) {
+    if (!conf.enable_optimizations || is_single_step) {
+        code.MOVI2R(code.ABI_SCRATCH1, A64::LocationDescriptor{terminal.next}.PC());
+        code.STR(INDEX_UNSIGNED, code.ABI_SCRATCH1, X28, offsetof(A64JitState, pc));
+        code.ReturnFromRunCode();
+        return;
+    }
+
+    patch_information[terminal.next].jmp.emplace_back(code.GetCodePtr());
+    if (auto next_bb = GetBasicBlock(terminal.next)) {
+        EmitPatchJmp(terminal.next, next_bb->entrypoint);
+    } else {
+        EmitPatchJmp(terminal.next);
+    }
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::PopRSBHint, IR::LocationDescriptor, bool is_single_step) {
+    if (!conf.enable_optimizations || is_single_step) {
+        code.ReturnFromRunCode();
+        return;
+    }
+
+    code.B(terminal_handler_pop_rsb_hint);
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::FastDispatchHint, IR::LocationDescriptor, bool is_single_step) {
+    if (conf.enable_fast_dispatch && !is_single_step) {
+        code.B(terminal_handler_fast_dispatch_hint);
+    } else {
+        code.ReturnFromRunCode();
+    }
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::If terminal, IR::LocationDescriptor initial_location, bool is_single_step) {
+    switch (terminal.if_) {
+    case IR::Cond::AL:
+    case IR::Cond::NV:
+        EmitTerminal(terminal.then_, initial_location, is_single_step);
+        break;
+    default:
+        FixupBranch pass = EmitCond(terminal.if_);
+        EmitTerminal(terminal.else_, initial_location, is_single_step);
+        code.SetJumpTarget(pass);
+        EmitTerminal(terminal.then_, initial_location, is_single_step);
+        break;
+    }
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::CheckBit terminal, IR::LocationDescriptor initial_location, bool is_single_step) {
+    FixupBranch fail;
+    code.LDRB(INDEX_UNSIGNED, DecodeReg(code.ABI_SCRATCH1), X28, offsetof(A64JitState, check_bit));
+    fail = code.CBZ(DecodeReg(code.ABI_SCRATCH1));
+    EmitTerminal(terminal.then_, initial_location, is_single_step);
+    code.SetJumpTarget(fail);
+    EmitTerminal(terminal.else_, initial_location, is_single_step);
+}
+
+void A64EmitA64::EmitTerminalImpl(IR::Term::CheckHalt terminal, IR::LocationDescriptor initial_location, bool is_single_step) {
+    code.LDRB(INDEX_UNSIGNED, DecodeReg(code.ABI_SCRATCH1), X28, offsetof(A64JitState, halt_requested));
+    // Conditional branch only gives +/- 1MB of branch distance
+    FixupBranch zero = code.CBZ(DecodeReg(code.ABI_SCRATCH1));
+    code.B(code.GetForceReturnFromRunCodeAddress());
+    code.SetJumpTarget(zero);
+    EmitTerminal(terminal.else_, initial_location, is_single_step);
+}
+
+void A64EmitA64::EmitPatchJg(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
+    const CodePtr patch_location = code.GetCodePtr();
+
+    auto long_branch_gt = [this](CodePtr ptr){
+        const s64 distance = reinterpret_cast<s64>(ptr) - reinterpret_cast<s64>(code.GetCodePtr());
+
+        if((distance >> 2) >= -0x40000 && (distance >> 2) <= 0x3FFFF) {
+            code.B(CC_GT, ptr);
+            return;
+        }
+
+        FixupBranch cc_le = code.B(CC_LE);
+        code.B(ptr);
+        code.SetJumpTarget(cc_le);
+    };
+
+    if (target_code_ptr) {
+        long_branch_gt(target_code_ptr);
+    } else {
+        code.MOVI2R(code.ABI_SCRATCH1, A64::LocationDescriptor{target_desc}.PC());
+        code.STR(INDEX_UNSIGNED, code.ABI_SCRATCH1, X28, offsetof(A64JitState, pc));
+        long_branch_gt(code.GetReturnFromRunCodeAddress());
+    }
+    code.EnsurePatchLocationSize(patch_location, 28);
+}
+
+void A64EmitA64::EmitPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
+    const CodePtr patch_location = code.GetCodePtr();
+    if (target_code_ptr) {
+        code.B(target_code_ptr);
+    } else {
+        code.MOVI2R(code.ABI_SCRATCH1, A64::LocationDescriptor{target_desc}.PC());
+        code.STR(INDEX_UNSIGNED, code.ABI_SCRATCH1, X28, offsetof(A64JitState, pc));
+        code.B(code.GetReturnFromRunCodeAddress());
+    }
+    code.EnsurePatchLocationSize(patch_location, 24);
+}
+
+void A64EmitA64::EmitPatchMovX0(CodePtr target_code_ptr) {
+    if (!target_code_ptr) {
+        target_code_ptr = code.GetReturnFromRunCodeAddress();
+    }
+    const CodePtr patch_location = code.GetCodePtr();
+    code.MOVP2R(X0, target_code_ptr);
+    code.EnsurePatchLocationSize(patch_location, 16);
+}
+
+void A64EmitA64::Unpatch(const IR::LocationDescriptor& location) {
+    EmitA64::Unpatch(location);
+    if (conf.enable_fast_dispatch) {
+        (*fast_dispatch_table_lookup)(location.Value()) = {};
+    }
+}
+
+} // namespace Dynarmic::BackendA64
@@ -0,0 +1,80 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "backend/A64/a64_jitstate.h"
+#include "common/bit_util.h"
+#include "frontend/A64/location_descriptor.h"
+
+namespace Dynarmic::BackendA64 {
+
+/**
+ * FPCR
+ * ====
+ *
+ * The guest FPCR is loaded into the host FPCR unchanged while running guest code,
+ * so only the bits the host implements are kept.
+ *
+ * A64 FPCR exception trap enables
+ * -------------------------------
+ * IDE  bit 15  Input Denormal exception trap enable
+ * IXE  bit 12  Inexact exception trap enable
+ * UFE  bit 11  Underflow exception trap enable
+ * OFE  bit 10  Overflow exception trap enable
+ * DZE  bit 9   Division by Zero exception trap enable
+ * IOE  bit 8   Invalid Operation exception trap enable
+ *
+ * A64 FPCR mode bits
+ * ------------------
+ * AHP  bit 26  Alternative half-precision
+ * DN   bit 25  Default NaN
+ * FZ   bit 24  Flush to Zero
+ * RMode    bits 22-23  Round to {0 = Nearest, 1 = Positive, 2 = Negative, 3 = Zero}
+ * FZ16 bit 19  Flush to Zero for half-precision
+ */
+
+constexpr u32 FPCR_MASK = 0x07C89F00;
+
+u32 A64JitState::GetFpcr() const {
+    return fpcr;
+}
+
+void A64JitState::SetFpcr(u32 value) {
+    fpcr = value & FPCR_MASK;
+
+    // Exception traps are never enabled on the host.
+    guest_fpcr = value & 0x07C80000;
+}
+
+/**
+ * FPSR
+ * ====
+ *
+ * A64 FPSR cumulative exception bits
+ * ----------------------------------
+ * QC   bit 27  Cumulative saturation bit
+ * IDC  bit 7   Input Denormal cumulative exception bit       // Only ever set when FPCR.FTZ = 1
+ * IXC  bit 4   Inexact cumulative exception bit
+ * UFC  bit 3   Underflow cumulative exception bit
+ * OFC  bit 2   Overflow cumulative exception bit
+ * DZC  bit 1   Division by Zero cumulative exception bit
+ * IOC  bit 0   Invalid Operation cumulative exception bit
+ */
+
+u32 A64JitState::GetFpsr() const {
+    u32 fpsr = 0;
+    fpsr |= static_cast<u32>(guest_fpsr & 0x0800009F);
+    fpsr |= fpsr_exc;
+    fpsr |= (fpsr_qc == 0 ? 0 : 1) << 27;
+    return fpsr;
+}
+
+void A64JitState::SetFpsr(u32 value) {
+    guest_fpsr = value & 0x0800009F;
+    fpsr_qc = (value >> 27) & 1;
+    fpsr_exc = value & 0x9F;
+}
+
+} // namespace Dynarmic::BackendA64
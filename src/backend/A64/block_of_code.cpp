@@ -20,6 +20,19 @@
     #include <sys/mman.h>
 #endif
 
+#if defined(DYNARMIC_ENABLE_CPU_FEATURE_DETECTION) && defined(__linux__)
+    #include <sys/auxv.h>
+    #ifndef HWCAP_AES
+        #define HWCAP_AES (1 << 3)
+    #endif
+    #ifndef HWCAP_PMULL
+        #define HWCAP_PMULL (1 << 4)
+    #endif
+    #ifndef HWCAP_CRC32
+        #define HWCAP_CRC32 (1 << 7)
+    #endif
+#endif
+
 namespace Dynarmic::BackendA64 {
 
 const Arm64Gen::ARM64Reg BlockOfCode::ABI_RETURN  = Arm64Gen::ARM64Reg::X0;
@@ -61,13 +74,32 @@ void ProtectMemory(const void* base, size_t size, bool is_executable) {
 }
 #endif
 
+constexpr u32 FeatureBit(HostFeature feature) {
+    return 1u << static_cast<u32>(feature);
+}
+
+u32 DetectHostFeatures() {
+    u32 features = 0;
+#if defined(DYNARMIC_ENABLE_CPU_FEATURE_DETECTION) && defined(__linux__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    if (hwcap & HWCAP_AES)
+        features |= FeatureBit(HostFeature::AES);
+    if (hwcap & HWCAP_PMULL)
+        features |= FeatureBit(HostFeature::PMULL);
+    if (hwcap & HWCAP_CRC32)
+        features |= FeatureBit(HostFeature::CRC32);
+#endif
+    return features;
+}
+
 } // anonymous namespace
 
 BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi)
         : fp_emitter(this)
         , cb(std::move(cb))
         , jsi(jsi)
-        , constant_pool(*this) {
+        , constant_pool(*this)
+        , host_features(DetectHostFeatures()) {
     AllocCodeSpace(TOTAL_CODE_SIZE);
     EnableWriting();
     GenRunCode();
@@ -166,7 +198,9 @@ void BlockOfCode::GenRunCode() {
     MOV(Arm64Gen::X26, ABI_RETURN);
 
     SwitchFpscrOnEntry();
-    BR(Arm64Gen::X25);
+    MOV(ABI_SCRATCH1, Arm64Gen::X25);
+    LoadPinnedRegisters();
+    BR(ABI_SCRATCH1);
 
     AlignCode16();
     step_code = reinterpret_cast<RunCodeFuncType>(GetWritableCodePtr());
@@ -178,6 +212,7 @@ void BlockOfCode::GenRunCode() {
     STR(Arm64Gen::INDEX_UNSIGNED, Arm64Gen::X26, Arm64Gen::X28, jsi.offsetof_cycles_to_run);    
 
     SwitchFpscrOnEntry();
+    LoadPinnedRegisters();
     BR(ABI_PARAM2);
 
     enter_fpscr_then_loop = GetCodePtr();
@@ -197,6 +232,8 @@ void BlockOfCode::GenRunCode() {
             SwitchFpscrOnExit();
         }
 
+        StorePinnedRegisters();
+
         cb.AddTicks->EmitCall(*this, [this](RegList param) {
             LDR(Arm64Gen::INDEX_UNSIGNED, param[0], Arm64Gen::X28, jsi.offsetof_cycles_to_run);
             SUB(param[0], param[0], Arm64Gen::X26);
@@ -256,6 +293,18 @@ void BlockOfCode::LookupBlock() {
     cb.LookupBlock->EmitCall(*this);
 }
 
+void BlockOfCode::LoadPinnedRegisters() {
+    for (const auto& pinned : cb.pinned_registers) {
+        LDR(Arm64Gen::INDEX_UNSIGNED, pinned.host_reg, Arm64Gen::X28, pinned.jit_state_offset);
+    }
+}
+
+void BlockOfCode::StorePinnedRegisters() {
+    for (const auto& pinned : cb.pinned_registers) {
+        STR(Arm64Gen::INDEX_UNSIGNED, pinned.host_reg, Arm64Gen::X28, pinned.jit_state_offset);
+    }
+}
+
 void BlockOfCode::EmitPatchLDR(Arm64Gen::ARM64Reg Rt, u64 lower, u64 upper) {
     ASSERT_MSG(!in_far_code, "Can't patch when in far code, yet!");
     constant_pool.EmitPatchLDR(Rt, lower, upper);
@@ -318,13 +367,8 @@ void BlockOfCode::EnsurePatchLocationSize(CodePtr begin, size_t size) {
     }
 }
 
-//bool BlockOfCode::DoesCpuSupport(Xbyak::util::Cpu::Type type) const {
-//#ifdef DYNARMIC_ENABLE_CPU_FEATURE_DETECTION
-//    return cpu_info.has(type);
-//#else
-//    (void)type;
-//    return false;
-//#endif
-//}
+bool BlockOfCode::DoesCpuSupport(HostFeature feature) const {
+    return (host_features & FeatureBit(feature)) != 0;
+}
 
 } // namespace Dynarmic::BackendA64
@@ -9,6 +9,7 @@
 #include <array>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "backend/A64/callback.h"
 #include "backend/A64/constant_pool.h"
@@ -20,11 +21,25 @@ namespace Dynarmic::BackendA64 {
 
 using CodePtr = const void*;
 
+/// Optional host CPU extensions the emitters make use of.
+enum class HostFeature {
+    AES,
+    CRC32,
+    PMULL,
+};
+
+/// A guest register that is kept in a host register for the duration of RunCode.
+struct PinnedRegister {
+    Arm64Gen::ARM64Reg host_reg;
+    size_t jit_state_offset;
+};
+
 struct RunCodeCallbacks {
     std::unique_ptr<Callback> LookupBlock;
     std::unique_ptr<Callback> AddTicks;
     std::unique_ptr<Callback> GetTicksRemaining;
     u64 value_in_X27;
+    std::vector<PinnedRegister> pinned_registers;
 };
 
 class BlockOfCode final : public Arm64Gen::ARM64CodeBlock {
@@ -64,6 +79,10 @@ public:
     /// Code emitter: Performs a block lookup based on current state
     /// @note this clobbers ABI caller-save registers
     void LookupBlock();
+    /// Code emitter: Loads pinned guest registers from the jit state
+    void LoadPinnedRegisters();
+    /// Code emitter: Writes pinned guest registers back to the jit state
+    void StorePinnedRegisters();
 
     u64 MConst(u64 lower, u64 upper = 0);
 
@@ -115,7 +134,7 @@ public:
 
     static const std::array<Arm64Gen::ARM64Reg, 8> ABI_PARAMS;
 
-    // bool DoesCpuSupport(Xbyak::util::Cpu::Type type) const;
+    bool DoesCpuSupport(HostFeature feature) const;
 
     JitStateInfo GetJitStateInfo() const { return jsi; }
 
@@ -141,7 +160,7 @@ private:
     std::array<const void*, 4> return_from_run_code;
     void GenRunCode();
 
-    //Xbyak::util::Cpu cpu_info;
+    u32 host_features;
 };
 
 } // namespace Dynarmic::BackendA64
@@ -4,6 +4,7 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
 #include <cstring>
 
 #include "backend/A64/block_of_code.h"
@@ -12,54 +13,103 @@
 
 namespace Dynarmic::BackendA64 {
 
-ConstantPool::ConstantPool(BlockOfCode& code) : code(code) {}
+static size_t HashConstant(u64 lower, u64 upper) {
+    u64 hash = lower ^ (upper * 0x9E3779B97F4A7C15);
+    hash ^= hash >> 32;
+    hash *= 0xBF58476D1CE4E5B9;
+    hash ^= hash >> 29;
+    return static_cast<size_t>(hash);
+}
+
+ConstantPool::ConstantPool(BlockOfCode& code) : code(code), table(initial_table_size) {}
 
 void ConstantPool::EmitPatchLDR(Arm64Gen::ARM64Reg Rt, u64 lower, u64 upper) {
-    const auto constant = std::make_tuple(lower, upper);
-    auto iter = constant_info.find(constant);
-    if (iter == constant_info.end()) {
-        struct PatchInfo p = { code.GetCodePtr(), Rt, constant };
-        patch_info.emplace_back(p);
-        code.BRK(0);
+    const u32 index = FindOrInsert(lower, upper);
+    patch_info.push_back({code.GetCodePtr(), Rt, index});
+    code.BRK(0);
+}
+
+void ConstantPool::PatchPool() {
+    if (patch_info.empty()) {
         return;
     }
 
-    const s32 offset = reinterpret_cast<size_t>(iter->second) - reinterpret_cast<size_t>(code.GetCodePtr());
+    u8* const unaligned_ptr = code.GetWritableCodePtr();
+    u8* const island_ptr = reinterpret_cast<u8*>((reinterpret_cast<uintptr_t>(unaligned_ptr) + align_size - 1) & ~(align_size - 1));
+    std::memset(unaligned_ptr, 0, island_ptr - unaligned_ptr);
 
-    if (!(offset >= -0x40000 && offset <= 0x3FFFF)) {
-        constant_info.erase(constant);
-        struct PatchInfo p = { code.GetCodePtr(), Rt, constant };
-        patch_info.emplace_back(p);
-        code.BRK(0x42);
-        return;
+    u8* pool_ptr = island_ptr;
+    for (const Constant& constant : island) {
+        std::memcpy(pool_ptr, &constant.lower, sizeof(u64));
+        std::memcpy(pool_ptr + sizeof(u64), &constant.upper, sizeof(u64));
+        pool_ptr += align_size;
     }
-    DEBUG_ASSERT((offset & 3) == 0);
-    code.LDR(Rt, offset / 4);
-}
 
-void ConstantPool::PatchPool() {
-    u8* pool_ptr = code.GetWritableCodePtr();
-    for (PatchInfo patch : patch_info) {
-        auto iter = constant_info.find(patch.constant);
-        if (iter == constant_info.end()) {
-            std::memcpy(pool_ptr, &std::get<0>(patch.constant), sizeof(u64));
-            std::memcpy(pool_ptr + sizeof(u64), &std::get<1>(patch.constant), sizeof(u64));
-            iter = constant_info.emplace(patch.constant, pool_ptr).first;
-            pool_ptr += align_size;
-        }
+    for (const PatchInfo& patch : patch_info) {
         code.SetCodePtr(patch.ptr);
 
-        const s32 offset = reinterpret_cast<size_t>(iter->second) - reinterpret_cast<size_t>(code.GetCodePtr());
+        const u8* const constant_ptr = island_ptr + patch.index * align_size;
+        const s64 offset = constant_ptr - reinterpret_cast<const u8*>(patch.ptr);
+        ASSERT_MSG(offset >= -0x100000 && offset <= 0xFFFFC, "Literal island out of range of LDR");
         DEBUG_ASSERT((offset & 3) == 0);
-        code.LDR(patch.Rt, offset / 4);
+        code.LDR(patch.Rt, static_cast<s32>(offset / 4));
     }
-    patch_info.clear();
+
     code.SetCodePtr(pool_ptr);
+    Reset();
+}
+
+void ConstantPool::Clear() {
+    Reset();
+}
+
+u32 ConstantPool::FindOrInsert(u64 lower, u64 upper) {
+    const size_t mask = table.size() - 1;
+    for (size_t i = HashConstant(lower, upper) & mask;; i = (i + 1) & mask) {
+        const Slot& slot = table[i];
+        if (slot.generation != generation) {
+            break;
+        }
+        if (slot.lower == lower && slot.upper == upper) {
+            return slot.index;
+        }
+    }
+
+    const u32 index = static_cast<u32>(island.size());
+    island.push_back({lower, upper});
+    if (island.size() * 2 > table.size()) {
+        Grow();
+    } else {
+        InsertSlot(lower, upper, index);
+    }
+    return index;
+}
+
+void ConstantPool::InsertSlot(u64 lower, u64 upper, u32 index) {
+    const size_t mask = table.size() - 1;
+    size_t i = HashConstant(lower, upper) & mask;
+    while (table[i].generation == generation) {
+        i = (i + 1) & mask;
+    }
+    table[i] = {lower, upper, generation, index};
 }
 
-void  ConstantPool::Clear() {
-    constant_info.clear();
+void ConstantPool::Grow() {
+    table.assign(table.size() * 2, Slot{});
+    for (size_t index = 0; index < island.size(); index++) {
+        InsertSlot(island[index].lower, island[index].upper, static_cast<u32>(index));
+    }
+}
+
+void ConstantPool::Reset() {
+    island.clear();
     patch_info.clear();
+
+    generation++;
+    if (generation == 0) {
+        std::fill(table.begin(), table.end(), Slot{});
+        generation = 1;
+    }
 }
 
 } // namespace Dynarmic::BackendA64
@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include <map>
+#include <vector>
 
 #include "common/common_types.h"
 
@@ -14,33 +14,55 @@ namespace Dynarmic::BackendA64 {
 
 class BlockOfCode;
 
-/// ConstantPool allocates a block of memory from BlockOfCode.
-/// It places constants into this block of memory, returning the address
-/// of the memory location where the constant is placed. If the constant
-/// already exists, its memory location is reused.
+/// ConstantPool collects the constants a block loads with LDR (literal) and
+/// places them in a literal island directly after that block, which keeps every
+/// load in range. A constant used more than once within a block is emitted once.
 class ConstantPool final {
 public:
     ConstantPool(BlockOfCode& code);
 
     void EmitPatchLDR(Arm64Gen::ARM64Reg Rt, u64 lower, u64 upper = 0);
 
+    /// Emits the pending literal island at the current code pointer and patches the loads that refer to it.
     void PatchPool();
 
     void Clear();
 
 private:
     static constexpr size_t align_size = 16; // bytes
+    static constexpr size_t initial_table_size = 64; // slots
 
-    std::map<std::tuple<u64, u64>, void*> constant_info;
+    struct Constant {
+        u64 lower;
+        u64 upper;
+    };
 
-    BlockOfCode& code;
+    /// Open-addressed table slot. A slot is occupied only if its generation is the current one,
+    /// so the table is emptied for each island by bumping the generation rather than by clearing it.
+    struct Slot {
+        u64 lower;
+        u64 upper;
+        u32 generation;
+        u32 index;
+    };
 
     struct PatchInfo {
         const void* ptr;
         Arm64Gen::ARM64Reg Rt;
-        std::tuple<u64, u64> constant;
+        u32 index;
     };
 
+    u32 FindOrInsert(u64 lower, u64 upper);
+    void InsertSlot(u64 lower, u64 upper, u32 index);
+    void Grow();
+    void Reset();
+
+    BlockOfCode& code;
+
+    std::vector<Constant> island;
+    std::vector<Slot> table;
+    u32 generation = 1;
+
     std::vector<PatchInfo> patch_info;
 };
 
@@ -152,12 +152,19 @@ void EmitA64::EmitAddCycles(size_t cycles) {
     code.SUBI2R(X26, X26, static_cast<u32>(cycles));
 }
 
-FixupBranch EmitA64::EmitCond(IR::Cond cond) {
-    FixupBranch label;
-
+void EmitA64::EmitLoadNZCV() {
     const Arm64Gen::ARM64Reg cpsr = code.ABI_SCRATCH1;
     code.LDR(INDEX_UNSIGNED, DecodeReg(cpsr), X28, code.GetJitStateInfo().offsetof_cpsr_nzcv);
     code._MSR(FIELD_NZCV, cpsr);
+}
+
+FixupBranch EmitA64::EmitCond(IR::Cond cond) {
+    EmitLoadNZCV();
+    return EmitCondBranch(cond);
+}
+
+FixupBranch EmitA64::EmitCondBranch(IR::Cond cond) {
+    FixupBranch label;
 
     switch (cond) {
     case IR::Cond::EQ: //z
@@ -87,7 +87,10 @@ protected:
     // Helpers
     virtual std::string LocationDescriptorToFriendlyName(const IR::LocationDescriptor&) const = 0;
     void EmitAddCycles(size_t cycles);
+    void EmitLoadNZCV();
     FixupBranch EmitCond(IR::Cond cond);
+    /// Like EmitCond, but assumes host NZCV already holds the guest's flags.
+    FixupBranch EmitCondBranch(IR::Cond cond);
     BlockDescriptor RegisterBlock(const IR::LocationDescriptor& location_descriptor, CodePtr entrypoint, size_t size);
     void PushRSBHelper(Arm64Gen::ARM64Reg loc_desc_reg, Arm64Gen::ARM64Reg index_reg, IR::LocationDescriptor target);
 
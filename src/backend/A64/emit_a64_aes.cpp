@@ -0,0 +1,104 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "backend/A64/block_of_code.h"
+#include "backend/A64/emit_a64.h"
+#include "common/common_types.h"
+#include "common/crypto/aes.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic::BackendA64 {
+
+namespace AES = Common::Crypto::AES;
+
+using AESFn = void(AES::State&, const AES::State&);
+
+static void EmitAESFunction(RegAlloc::ArgumentInfo args, EmitContext& ctx, BlockOfCode& code,
+                            IR::Inst* inst, AESFn fn) {
+    constexpr u32 stack_space = static_cast<u32>(sizeof(AES::State)) * 2;
+    const ARM64Reg input = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.SUB(SP, SP, stack_space);
+    code.ADD(code.ABI_PARAM1, SP, 0);
+    code.ADD(code.ABI_PARAM2, SP, sizeof(AES::State));
+
+    code.fp_emitter.STR(128, INDEX_UNSIGNED, input, code.ABI_PARAM2, 0);
+
+    code.QuickCallFunction(fn);
+
+    code.fp_emitter.LDR(128, INDEX_UNSIGNED, result, SP, 0);
+
+    // Free memory
+    code.ADD(SP, SP, stack_space);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+// AESE and AESD also XOR in a round key; the IR op has already done so, so a zero key is used.
+static void EmitAESRound(RegAlloc::ArgumentInfo args, EmitContext& ctx, BlockOfCode& code,
+                         IR::Inst* inst, void (Arm64Gen::ARM64FloatEmitter::*round)(ARM64Reg, ARM64Reg)) {
+    const ARM64Reg data = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg zero = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.EOR(zero, zero, zero);
+    (code.fp_emitter.*round)(data, zero);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitA64::EmitAESDecryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(HostFeature::AES)) {
+        EmitAESRound(args, ctx, code, inst, &Arm64Gen::ARM64FloatEmitter::AESD);
+    } else {
+        EmitAESFunction(args, ctx, code, inst, AES::DecryptSingleRound);
+    }
+}
+
+void EmitA64::EmitAESEncryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(HostFeature::AES)) {
+        EmitAESRound(args, ctx, code, inst, &Arm64Gen::ARM64FloatEmitter::AESE);
+    } else {
+        EmitAESFunction(args, ctx, code, inst, AES::EncryptSingleRound);
+    }
+}
+
+void EmitA64::EmitAESInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(HostFeature::AES)) {
+        const ARM64Reg data = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+        code.fp_emitter.AESIMC(data, data);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+    } else {
+        EmitAESFunction(args, ctx, code, inst, AES::InverseMixColumns);
+    }
+}
+
+void EmitA64::EmitAESMixColumns(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(HostFeature::AES)) {
+        const ARM64Reg data = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+        code.fp_emitter.AESMC(data, data);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+    } else {
+        EmitAESFunction(args, ctx, code, inst, AES::MixColumns);
+    }
+}
+
+} // namespace Dynarmic::BackendA64
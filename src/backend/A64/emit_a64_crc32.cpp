@@ -0,0 +1,71 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <climits>
+
+#include "backend/A64/block_of_code.h"
+#include "backend/A64/emit_a64.h"
+#include "common/crypto/crc32.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic::BackendA64 {
+
+namespace CRC32 = Common::Crypto::CRC32;
+
+using CRC32Fn = void (Arm64Gen::ARM64XEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg);
+using CRC32FallbackFn = u32(u32, u64, int);
+
+static void EmitCRC32(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, const int data_size, CRC32Fn fn, CRC32FallbackFn fallback_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(HostFeature::CRC32)) {
+        const ARM64Reg crc = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[0]));
+        const ARM64Reg value = data_size == 64 ? ctx.reg_alloc.UseGpr(args[1]) : DecodeReg(ctx.reg_alloc.UseGpr(args[1]));
+
+        (code.*fn)(crc, crc, value);
+
+        ctx.reg_alloc.DefineValue(inst, crc);
+    } else {
+        ctx.reg_alloc.HostCall(inst, args[0], args[1], {});
+        code.MOVI2R(code.ABI_PARAM3, data_size / CHAR_BIT);
+        code.QuickCallFunction(fallback_fn);
+    }
+}
+
+void EmitA64::EmitCRC32Castagnoli8(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 8, &Arm64Gen::ARM64XEmitter::CRC32CB, CRC32::ComputeCRC32Castagnoli);
+}
+
+void EmitA64::EmitCRC32Castagnoli16(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 16, &Arm64Gen::ARM64XEmitter::CRC32CH, CRC32::ComputeCRC32Castagnoli);
+}
+
+void EmitA64::EmitCRC32Castagnoli32(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 32, &Arm64Gen::ARM64XEmitter::CRC32CW, CRC32::ComputeCRC32Castagnoli);
+}
+
+void EmitA64::EmitCRC32Castagnoli64(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 64, &Arm64Gen::ARM64XEmitter::CRC32CX, CRC32::ComputeCRC32Castagnoli);
+}
+
+void EmitA64::EmitCRC32ISO8(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 8, &Arm64Gen::ARM64XEmitter::CRC32B, CRC32::ComputeCRC32ISO);
+}
+
+void EmitA64::EmitCRC32ISO16(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 16, &Arm64Gen::ARM64XEmitter::CRC32H, CRC32::ComputeCRC32ISO);
+}
+
+void EmitA64::EmitCRC32ISO32(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 32, &Arm64Gen::ARM64XEmitter::CRC32W, CRC32::ComputeCRC32ISO);
+}
+
+void EmitA64::EmitCRC32ISO64(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32(code, ctx, inst, 64, &Arm64Gen::ARM64XEmitter::CRC32X, CRC32::ComputeCRC32ISO);
+}
+
+} // namespace Dynarmic::BackendA64
@@ -24,24 +24,17 @@ void EmitA64::EmitPack2x32To1x64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, lo);
 }
 
-//void EmitA64::EmitPack2x64To1x128(EmitContext& ctx, IR::Inst* inst) {
-//    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-//    Xbyak::Reg64 lo = ctx.reg_alloc.UseGpr(args[0]);
-//    Xbyak::Reg64 hi = ctx.reg_alloc.UseGpr(args[1]);
-//    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
-//
-//    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
-//        code.movq(result, lo);
-//        code.pinsrq(result, hi, 1);
-//    } else {
-//        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
-//        code.movq(result, lo);
-//        code.movq(tmp, hi);
-//        code.punpcklqdq(result, tmp);
-//    }
-//
-//    ctx.reg_alloc.DefineValue(inst, result);
-//}
+void EmitA64::EmitPack2x64To1x128(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg lo = ctx.reg_alloc.UseGpr(args[0]);
+    ARM64Reg hi = ctx.reg_alloc.UseGpr(args[1]);
+    ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.INS(64, result, 0, lo);
+    code.fp_emitter.INS(64, result, 1, hi);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
 
 void EmitA64::EmitLeastSignificantWord(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -498,36 +491,36 @@ void EmitA64::EmitArithmeticShiftRight32(EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
-//void EmitA64::EmitArithmeticShiftRight64(EmitContext& ctx, IR::Inst* inst) {
-//    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-//    auto& operand_arg = args[0];
-//    auto& shift_arg = args[1];
-//
-//    if (shift_arg.IsImmediate()) {
-//        u8 shift = shift_arg.GetImmediateU8();
-//        Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(operand_arg);
-//
-//        code.sar(result, u8(shift < 63 ? shift : 63));
-//
-//        ctx.reg_alloc.DefineValue(inst, result);
-//    } else {
-//        ctx.reg_alloc.UseScratch(shift_arg, HostLoc::RCX);
-//        Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(operand_arg);
-//        Xbyak::Reg64 const63 = ctx.reg_alloc.ScratchGpr();
-//
-//        // The 64-bit x64 SAR instruction masks the shift count by 0x3F before performing the shift.
-//        // ARM differs from the behaviour: It does not mask the count.
-//
-//        // We note that all shift values above 63 have the same behaviour as 63 does, so we saturate `shift` to 63.
-//        code.mov(const63, 63);
-//        code.movzx(code.ecx, code.cl);
-//        code.cmp(code.ecx, u32(63));
-//        code.cmovg(code.ecx, const63);
-//        code.sar(result, code.cl);
-//
-//        ctx.reg_alloc.DefineValue(inst, result);
-//    }
-//}
+void EmitA64::EmitArithmeticShiftRight64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto& operand_arg = args[0];
+    auto& shift_arg = args[1];
+
+    if (shift_arg.IsImmediate()) {
+        u8 shift = shift_arg.GetImmediateU8();
+        ARM64Reg result = ctx.reg_alloc.UseScratchGpr(operand_arg);
+
+        code.ASR(result, result, u8(shift < 63 ? shift : 63));
+
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else {
+        ARM64Reg shift = ctx.reg_alloc.UseScratchGpr(shift_arg);
+        ARM64Reg result = ctx.reg_alloc.UseScratchGpr(operand_arg);
+        ARM64Reg const63 = ctx.reg_alloc.ScratchGpr();
+
+        // The 64-bit arm64 ASR instruction masks the shift count by 0x3F before performing the shift.
+        // ARM differs from the behaviour: It does not mask the count.
+
+        // We note that all shift values above 63 have the same behaviour as 63 does, so we saturate `shift` to 63.
+        code.ANDI2R(shift, shift, 0xFF);
+        code.MOVI2R(const63, 63);
+        code.CMPI2R(shift, u32(63));
+        code.CSEL(shift, shift, const63, CC_LE);
+        code.ASRV(result, result, shift);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+    }
+}
 
 void EmitA64::EmitRotateRight32(EmitContext& ctx, IR::Inst* inst) {
     auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
@@ -659,6 +652,87 @@ void EmitA64::EmitRotateRightExtended(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+template <typename ShiftFT, typename ShiftVFT>
+static void EmitMaskedShift32(EmitContext& ctx, IR::Inst* inst, ShiftFT shift_fn, ShiftVFT shiftv_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto& operand_arg = args[0];
+    auto& shift_arg = args[1];
+
+    if (shift_arg.IsImmediate()) {
+        ARM64Reg result = DecodeReg(ctx.reg_alloc.UseScratchGpr(operand_arg));
+        u32 shift = shift_arg.GetImmediateU32();
+
+        shift_fn(result, static_cast<int>(shift & 0x1F));
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    // The register forms of the host shifts already take the shift amount modulo the register size.
+    ARM64Reg result = DecodeReg(ctx.reg_alloc.UseScratchGpr(operand_arg));
+    ARM64Reg shift = DecodeReg(ctx.reg_alloc.UseGpr(shift_arg));
+
+    shiftv_fn(result, shift);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <typename ShiftFT, typename ShiftVFT>
+static void EmitMaskedShift64(EmitContext& ctx, IR::Inst* inst, ShiftFT shift_fn, ShiftVFT shiftv_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto& operand_arg = args[0];
+    auto& shift_arg = args[1];
+
+    if (shift_arg.IsImmediate()) {
+        ARM64Reg result = ctx.reg_alloc.UseScratchGpr(operand_arg);
+        u64 shift = shift_arg.GetImmediateU64();
+
+        shift_fn(result, static_cast<int>(shift & 0x3F));
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(operand_arg);
+    ARM64Reg shift = ctx.reg_alloc.UseGpr(shift_arg);
+
+    shiftv_fn(result, shift);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitLogicalShiftLeftMasked32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift32(ctx, inst, [&](auto result, int shift) { code.LSL(result, result, shift); }, [&](auto result, auto shift) { code.LSLV(result, result, shift); });
+}
+
+void EmitA64::EmitLogicalShiftLeftMasked64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift64(ctx, inst, [&](auto result, int shift) { code.LSL(result, result, shift); }, [&](auto result, auto shift) { code.LSLV(result, result, shift); });
+}
+
+void EmitA64::EmitLogicalShiftRightMasked32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift32(ctx, inst, [&](auto result, int shift) { code.LSR(result, result, shift); }, [&](auto result, auto shift) { code.LSRV(result, result, shift); });
+}
+
+void EmitA64::EmitLogicalShiftRightMasked64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift64(ctx, inst, [&](auto result, int shift) { code.LSR(result, result, shift); }, [&](auto result, auto shift) { code.LSRV(result, result, shift); });
+}
+
+void EmitA64::EmitArithmeticShiftRightMasked32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift32(ctx, inst, [&](auto result, int shift) { code.ASR(result, result, shift); }, [&](auto result, auto shift) { code.ASRV(result, result, shift); });
+}
+
+void EmitA64::EmitArithmeticShiftRightMasked64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift64(ctx, inst, [&](auto result, int shift) { code.ASR(result, result, shift); }, [&](auto result, auto shift) { code.ASRV(result, result, shift); });
+}
+
+void EmitA64::EmitRotateRightMasked32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift32(ctx, inst, [&](auto result, int shift) { code.ROR(result, result, shift); }, [&](auto result, auto shift) { code.RORV(result, result, shift); });
+}
+
+void EmitA64::EmitRotateRightMasked64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMaskedShift64(ctx, inst, [&](auto result, int shift) { code.ROR(result, result, shift); }, [&](auto result, auto shift) { code.RORV(result, result, shift); });
+}
+
 static Arm64Gen::ARM64Reg DoCarry(RegAlloc& reg_alloc, Argument& carry_in, IR::Inst* carry_out) {
     if (carry_in.IsImmediate()) {
         return carry_out ? reg_alloc.ScratchGpr() : INVALID_REG;
@@ -739,6 +813,33 @@ void EmitA64::EmitAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitAdd(code, ctx, inst, 64);
 }
 
+static void EmitAddShiftedLeft(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[2].IsImmediate());
+
+    const u8 shift = args[2].GetImmediateU8();
+
+    Arm64Gen::ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    Arm64Gen::ARM64Reg op_arg = ctx.reg_alloc.UseGpr(args[1]);
+
+    if (bitsize != 64) {
+        result = DecodeReg(result);
+        op_arg = DecodeReg(op_arg);
+    }
+
+    code.ADD(result, result, op_arg, ArithOption{result, ST_LSL, shift});
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitAddShiftedLeft32(EmitContext& ctx, IR::Inst* inst) {
+    EmitAddShiftedLeft(code, ctx, inst, 32);
+}
+
+void EmitA64::EmitAddShiftedLeft64(EmitContext& ctx, IR::Inst* inst) {
+    EmitAddShiftedLeft(code, ctx, inst, 64);
+}
+
 static void EmitSub(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
     auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
     auto overflow_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
@@ -837,6 +938,27 @@ void EmitA64::EmitMul64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitA64::EmitSignedMultiplyHigh64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    ARM64Reg op_arg = ctx.reg_alloc.UseGpr(args[1]);
+
+    code.SMULH(result, result, op_arg);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitUnsignedMultiplyHigh64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    ARM64Reg op_arg = ctx.reg_alloc.UseGpr(args[1]);
+
+    code.UMULH(result, result, op_arg);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
 
 void EmitA64::EmitUnsignedDiv32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -912,6 +1034,38 @@ void EmitA64::EmitAnd64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitA64::EmitAndNot32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Arm64Gen::ARM64Reg result = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[0]));
+
+    if (args[1].IsImmediate()) {
+        u32 op_arg = ~args[1].GetImmediateU32();
+        code.ANDI2R(result, result, op_arg, ctx.reg_alloc.ScratchGpr());
+    } else {
+        Arm64Gen::ARM64Reg op_arg = DecodeReg(ctx.reg_alloc.UseGpr(args[1]));
+        code.BIC(result, result, op_arg);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitAndNot64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Arm64Gen::ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+
+    if (args[1].IsImmediate()) {
+        u64 op_arg = ~args[1].GetImmediateU64();
+        code.ANDI2R(result, result, op_arg, ctx.reg_alloc.ScratchGpr());
+    } else {
+        Arm64Gen::ARM64Reg op_arg = ctx.reg_alloc.UseGpr(args[1]);
+        code.BIC(result, result, op_arg);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitA64::EmitEor32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -1073,19 +1227,20 @@ void EmitA64::EmitZeroExtendWordToLong(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
-//void EmitA64::EmitZeroExtendLongToQuad(EmitContext& ctx, IR::Inst* inst) {
-//    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-//    if (args[0].IsInGpr()) {
-//        Xbyak::Reg64 source = ctx.reg_alloc.UseGpr(args[0]);
-//        Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
-//        code.movq(result, source);
-//        ctx.reg_alloc.DefineValue(inst, result);
-//    } else {
-//        Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
-//        code.movq(result, result);
-//        ctx.reg_alloc.DefineValue(inst, result);
-//    }
-//}
+void EmitA64::EmitZeroExtendLongToQuad(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    if (args[0].IsInGpr()) {
+        ARM64Reg source = ctx.reg_alloc.UseGpr(args[0]);
+        ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+        code.fp_emitter.FMOV(EncodeRegToDouble(result), source);
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else {
+        ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+        // A write to a D register zeroes the upper half of the vector register.
+        code.fp_emitter.FMOV(EncodeRegToDouble(result), EncodeRegToDouble(result));
+        ctx.reg_alloc.DefineValue(inst, result);
+    }
+}
 
 void EmitA64::EmitByteReverseWord(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -1101,12 +1256,12 @@ void EmitA64::EmitByteReverseHalf(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
-//void EmitA64::EmitByteReverseDual(EmitContext& ctx, IR::Inst* inst) {
-//    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-//    Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(args[0]);
-//    code.bswap(result);
-//    ctx.reg_alloc.DefineValue(inst, result);
-//}
+void EmitA64::EmitByteReverseDual(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    code.REV64(result, result);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
 
 void EmitA64::EmitCountLeadingZeros32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -1125,4 +1280,94 @@ void EmitA64::EmitCountLeadingZeros64(EmitContext& ctx, IR::Inst* inst) {
    code.CLZ(result, source);
    ctx.reg_alloc.DefineValue(inst, result);
 }
+
+void EmitA64::EmitExtractRegister32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg result = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[0]));
+    ARM64Reg operand = DecodeReg(ctx.reg_alloc.UseGpr(args[1]));
+    const u8 lsb = args[2].GetImmediateU8();
+
+    code.EXTR(result, operand, result, lsb);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitExtractRegister64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    ARM64Reg operand = ctx.reg_alloc.UseGpr(args[1]);
+    const u8 lsb = args[2].GetImmediateU8();
+
+    code.EXTR(result, operand, result, lsb);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitReplicateBit32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg result = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[0]));
+    const u8 bit = args[1].GetImmediateU8();
+
+    // SBFX result, result, #bit, #1
+    code.SBFM(result, result, bit, bit);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitReplicateBit64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const u8 bit = args[1].GetImmediateU8();
+
+    // SBFX result, result, #bit, #1
+    code.SBFM(result, result, bit, bit);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+static void EmitMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize, CCFlags select_x) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ARM64Reg x = ctx.reg_alloc.UseGpr(args[0]);
+    ARM64Reg y = ctx.reg_alloc.UseScratchGpr(args[1]);
+
+    x = bitsize == 64 ? x : DecodeReg(x);
+    y = bitsize == 64 ? y : DecodeReg(y);
+
+    code.CMP(x, y);
+    code.CSEL(y, x, y, select_x);
+
+    ctx.reg_alloc.DefineValue(inst, y);
+}
+
+void EmitA64::EmitMaxSigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 32, CC_GT);
+}
+
+void EmitA64::EmitMaxSigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 64, CC_GT);
+}
+
+void EmitA64::EmitMaxUnsigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 32, CC_HI);
+}
+
+void EmitA64::EmitMaxUnsigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 64, CC_HI);
+}
+
+void EmitA64::EmitMinSigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 32, CC_LT);
+}
+
+void EmitA64::EmitMinSigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 64, CC_LT);
+}
+
+void EmitA64::EmitMinUnsigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 32, CC_LO);
+}
+
+void EmitA64::EmitMinUnsigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitMinMax(code, ctx, inst, 64, CC_LO);
+}
 } // namespace Dynarmic::BackendA64
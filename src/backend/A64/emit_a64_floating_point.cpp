@@ -149,6 +149,38 @@ void EmitA64::EmitFPDiv64(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FDIV);
 }
 
+void EmitA64::EmitFPMax32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMAX);
+}
+
+void EmitA64::EmitFPMax64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMAX);
+}
+
+void EmitA64::EmitFPMaxNumeric32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMAXNM);
+}
+
+void EmitA64::EmitFPMaxNumeric64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMAXNM);
+}
+
+void EmitA64::EmitFPMin32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMIN);
+}
+
+void EmitA64::EmitFPMin64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMIN);
+}
+
+void EmitA64::EmitFPMinNumeric32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMINNM);
+}
+
+void EmitA64::EmitFPMinNumeric64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMINNM);
+}
+
 void EmitA64::EmitFPMul32(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMUL);
 }
@@ -156,12 +188,115 @@ void EmitA64::EmitFPMul32(EmitContext& ctx, IR::Inst* inst) {
 void EmitA64::EmitFPMul64(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMUL);
 }
+
+template<size_t fsize>
+static void EmitFPMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+    ARM64Reg operand1 = ctx.reg_alloc.UseFpr(args[1]);
+    ARM64Reg operand2 = ctx.reg_alloc.UseFpr(args[2]);
+    result = fsize == 32 ? EncodeRegToSingle(result) : EncodeRegToDouble(result);
+    operand1 = fsize == 32 ? EncodeRegToSingle(operand1) : EncodeRegToDouble(operand1);
+    operand2 = fsize == 32 ? EncodeRegToSingle(operand2) : EncodeRegToDouble(operand2);
+
+    // Fused, so rounding happens once as the guest expects.
+    code.fp_emitter.FMADD(result, operand1, operand2, result);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitFPMulAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPMulAdd<32>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPMulAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPMulAdd<64>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPMulX32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMULX);
+}
+
+void EmitA64::EmitFPMulX64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FMULX);
+}
+
+void EmitA64::EmitFPRecipEstimate32(EmitContext& ctx, IR::Inst* inst) {
+    FPTwoOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRECPE);
+}
+
+void EmitA64::EmitFPRecipEstimate64(EmitContext& ctx, IR::Inst* inst) {
+    FPTwoOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRECPE);
+}
+
+void EmitA64::EmitFPRecipExponent32(EmitContext& ctx, IR::Inst* inst) {
+    FPTwoOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRECPX);
+}
+
+void EmitA64::EmitFPRecipExponent64(EmitContext& ctx, IR::Inst* inst) {
+    FPTwoOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRECPX);
+}
+
+void EmitA64::EmitFPRecipStepFused32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRECPS);
+}
+
+void EmitA64::EmitFPRecipStepFused64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRECPS);
+}
+
+template<size_t fsize>
+static void EmitFPRound(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
+    const bool exact = args[2].GetImmediateU1();
+
+    ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+    result = fsize == 32 ? EncodeRegToSingle(result) : EncodeRegToDouble(result);
+
+    if (exact) {
+        // FRINTX signals Inexact but can only round with the current FPCR mode, which is
+        // the only mode the frontends request exact rounding with.
+        ASSERT(rounding_mode == ctx.FPSCR_RMode());
+        code.fp_emitter.FRINTX(result, result);
+    } else {
+        code.fp_emitter.FRINT(result, result, ConvertRoundingModeToA64RoundingMode(rounding_mode));
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitFPRoundInt32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPRound<32>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPRoundInt64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPRound<64>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPRSqrtEstimate32(EmitContext& ctx, IR::Inst* inst) {
+    FPTwoOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRSQRTE);
+}
+
+void EmitA64::EmitFPRSqrtEstimate64(EmitContext& ctx, IR::Inst* inst) {
+    FPTwoOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRSQRTE);
+}
+
+void EmitA64::EmitFPRSqrtStepFused32(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRSQRTS);
+}
+
+void EmitA64::EmitFPRSqrtStepFused64(EmitContext& ctx, IR::Inst* inst) {
+    FPThreeOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FRSQRTS);
+}
 void EmitA64::EmitFPSqrt32(EmitContext& ctx, IR::Inst* inst) {
-    FPTwoOp<32>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FSQRT);
+    FPTwoOp<32, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FSQRT);
 }
 
 void EmitA64::EmitFPSqrt64(EmitContext& ctx, IR::Inst* inst) {
-    FPTwoOp<64>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FSQRT);
+    FPTwoOp<64, void(Arm64Gen::ARM64FloatEmitter::*)(ARM64Reg, ARM64Reg)>(code, ctx, inst, &Arm64Gen::ARM64FloatEmitter::FSQRT);
 }
 
 void EmitA64::EmitFPSub32(EmitContext& ctx, IR::Inst* inst) {
@@ -52,6 +52,52 @@ void EmitSignedSaturatedOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst)
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
+
+template<Op op, size_t size>
+void EmitUnsignedSaturatedOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    const auto overflow_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ARM64Reg result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    ARM64Reg addend = ctx.reg_alloc.UseScratchGpr(args[1]);
+    ARM64Reg zr = ZR;
+
+    if constexpr (size < 64) {
+        result = DecodeReg(result);
+        addend = DecodeReg(addend);
+        zr = WZR;
+    }
+
+    // Narrow operands are moved to the top of the register so that the carry flag reports their overflow.
+    if constexpr (size < 32) {
+        code.LSL(result, result, 32 - size);
+        code.LSL(addend, addend, 32 - size);
+    }
+
+    if constexpr (op == Op::Add) {
+        code.ADDS(result, result, addend);
+        code.CSINV(result, result, zr, CC_CC);
+    } else {
+        code.SUBS(result, result, addend);
+        code.CSEL(result, result, zr, CC_CS);
+    }
+
+    if (overflow_inst) {
+        ARM64Reg overflow = DecodeReg(ctx.reg_alloc.ScratchGpr());
+
+        code.CSET(overflow, op == Op::Add ? CC_CS : CC_CC);
+
+        ctx.reg_alloc.DefineValue(overflow_inst, overflow);
+        ctx.EraseInstruction(overflow_inst);
+    }
+
+    if constexpr (size < 32) {
+        code.LSR(result, result, 32 - size);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
 } // anonymous namespace
 
 void EmitA64::EmitSignedSaturatedAdd8(EmitContext& ctx, IR::Inst* inst) {
@@ -70,6 +116,64 @@ void EmitA64::EmitSignedSaturatedAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitSignedSaturatedOp<Op::Add, 64>(code, ctx, inst);
 }
 
+void EmitA64::EmitSignedSaturatedDoublingMultiplyReturnHigh16(EmitContext& ctx, IR::Inst* inst) {
+    const auto overflow_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg x = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[0]));
+    const ARM64Reg y = DecodeReg(ctx.reg_alloc.UseScratchGpr(args[1]));
+    const ARM64Reg tmp = DecodeReg(ctx.reg_alloc.ScratchGpr());
+
+    code.SXTH(x, x);
+    code.SXTH(y, y);
+    code.MUL(x, x, y);
+    code.ASR(y, x, 15);
+
+    // Doubling the product only overflows for -0x8000 * -0x8000.
+    code.CMPI2R(x, 0x40000000, tmp);
+    code.MOVI2R(tmp, 0x7FFF);
+    code.CSEL(y, tmp, y, CC_EQ);
+
+    if (overflow_inst) {
+        code.CSET(tmp, CC_EQ);
+
+        ctx.reg_alloc.DefineValue(overflow_inst, tmp);
+        ctx.EraseInstruction(overflow_inst);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, y);
+}
+
+void EmitA64::EmitSignedSaturatedDoublingMultiplyReturnHigh32(EmitContext& ctx, IR::Inst* inst) {
+    const auto overflow_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg x = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const ARM64Reg y = ctx.reg_alloc.UseScratchGpr(args[1]);
+    const ARM64Reg tmp = ctx.reg_alloc.ScratchGpr();
+
+    code.SXTW(x, x);
+    code.SXTW(y, y);
+    code.MUL(x, x, y);
+    code.ASR(y, x, 31);
+
+    // Doubling the product only overflows for -0x80000000 * -0x80000000.
+    code.CMPI2R(x, u64(1) << 62, tmp);
+    code.MOVI2R(DecodeReg(tmp), 0x7FFFFFFF);
+    code.CSEL(y, tmp, y, CC_EQ);
+
+    if (overflow_inst) {
+        code.CSET(DecodeReg(tmp), CC_EQ);
+
+        ctx.reg_alloc.DefineValue(overflow_inst, tmp);
+        ctx.EraseInstruction(overflow_inst);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, y);
+}
+
 void EmitA64::EmitSignedSaturatedSub8(EmitContext& ctx, IR::Inst* inst) {
     EmitSignedSaturatedOp<Op::Sub, 8>(code, ctx, inst);
 }
@@ -135,6 +239,38 @@ void EmitA64::EmitSignedSaturation(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitA64::EmitUnsignedSaturatedAdd8(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Add, 8>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Add, 16>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Add, 32>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Add, 64>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedSub8(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Sub, 8>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Sub, 16>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedSub32(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Sub, 32>(code, ctx, inst);
+}
+
+void EmitA64::EmitUnsignedSaturatedSub64(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedSaturatedOp<Op::Sub, 64>(code, ctx, inst);
+}
+
 void EmitA64::EmitUnsignedSaturation(EmitContext& ctx, IR::Inst* inst) {
     const auto overflow_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
 
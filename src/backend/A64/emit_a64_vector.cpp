@@ -0,0 +1,1473 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <array>
+
+#include "backend/A64/block_of_code.h"
+#include "backend/A64/emit_a64.h"
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic::BackendA64 {
+
+namespace {
+
+using ThreeOpFn = void (ARM64FloatEmitter::*)(ESize, ARM64Reg, ARM64Reg, ARM64Reg);
+using TwoOpFn = void (ARM64FloatEmitter::*)(ESize, ARM64Reg, ARM64Reg);
+
+void EmitVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, ESize esize, ThreeOpFn fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    (code.fp_emitter.*fn)(esize, a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitOneArgumentVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, ESize esize, TwoOpFn fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    (code.fp_emitter.*fn)(esize, a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+// Operations on the lower 64 bits; writing the D form of a register zeroes the upper half.
+void EmitVectorLowerOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, ESize esize, ThreeOpFn fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = EncodeRegToDouble(ctx.reg_alloc.UseScratchFpr(args[0]));
+    const ARM64Reg b = EncodeRegToDouble(ctx.reg_alloc.UseFpr(args[1]));
+
+    (code.fp_emitter.*fn)(esize, a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitVectorGetElement(size_t esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 index = args[1].GetImmediateU8();
+
+    const ARM64Reg source = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg dest = esize == 64 ? ctx.reg_alloc.ScratchGpr() : DecodeReg(ctx.reg_alloc.ScratchGpr());
+
+    code.fp_emitter.UMOV(static_cast<u8>(esize), dest, source, index);
+
+    ctx.reg_alloc.DefineValue(inst, dest);
+}
+
+void EmitVectorSetElement(size_t esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 index = args[1].GetImmediateU8();
+
+    const ARM64Reg source_vector = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg source_elem = ctx.reg_alloc.UseGpr(args[2]);
+
+    code.fp_emitter.INS(static_cast<u8>(esize), source_vector, index, source_elem);
+
+    ctx.reg_alloc.DefineValue(inst, source_vector);
+}
+
+void EmitVectorBroadcast(size_t esize, bool lower, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseGpr(args[0]);
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.DUP(static_cast<u8>(esize), lower ? EncodeRegToDouble(result) : result, a);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitVectorArithmeticShiftRight(ESize esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+    // Shifting by the element size or more fills each element with its sign bit.
+    const u32 shift = std::min<u32>(args[1].GetImmediateU8(), esize_bits);
+
+    if (shift != 0) {
+        code.fp_emitter.SSHR(esize, result, result, shift);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitVectorLogicalShiftLeft(ESize esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+    const u32 shift = args[1].GetImmediateU8();
+
+    if (shift >= esize_bits) {
+        code.fp_emitter.EOR(result, result, result);
+    } else if (shift != 0) {
+        code.fp_emitter.SHL(esize, result, result, shift);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitVectorLogicalShiftRight(ESize esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+    const u32 shift = args[1].GetImmediateU8();
+
+    if (shift >= esize_bits) {
+        code.fp_emitter.EOR(result, result, result);
+    } else if (shift != 0) {
+        code.fp_emitter.USHR(esize, result, result, shift);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+// NEON has no 64-bit integer min/max, so compare and select instead.
+void EmitVectorMinMax64(bool is_signed, bool is_max, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg mask = ctx.reg_alloc.ScratchFpr();
+
+    const ARM64Reg lhs = is_max ? a : b;
+    const ARM64Reg rhs = is_max ? b : a;
+    if (is_signed) {
+        code.fp_emitter.CMGT(D, mask, lhs, rhs);
+    } else {
+        code.fp_emitter.CMHI(D, mask, lhs, rhs);
+    }
+    code.fp_emitter.BSL(mask, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, mask);
+}
+
+void EmitVectorMultiplyUpperAndLower(ESize esize, bool is_signed, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    const auto upper_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetUpperFromOp);
+    const auto lower_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetLowerFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg x = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg y = ctx.reg_alloc.UseFpr(args[1]);
+    const u8 esize_bits = static_cast<u8>(8u << static_cast<u32>(esize));
+
+    if (upper_inst) {
+        const ARM64Reg upper_result = ctx.reg_alloc.ScratchFpr();
+        const ARM64Reg tmp = ctx.reg_alloc.ScratchFpr();
+
+        if (is_signed) {
+            code.fp_emitter.SMULL(esize, upper_result, EncodeRegToDouble(x), EncodeRegToDouble(y));
+            code.fp_emitter.SMULL2(esize, tmp, x, y);
+        } else {
+            code.fp_emitter.UMULL(esize, upper_result, EncodeRegToDouble(x), EncodeRegToDouble(y));
+            code.fp_emitter.UMULL2(esize, tmp, x, y);
+        }
+        code.fp_emitter.UZP2(esize_bits, upper_result, upper_result, tmp);
+
+        ctx.reg_alloc.DefineValue(upper_inst, upper_result);
+        ctx.EraseInstruction(upper_inst);
+    }
+
+    if (lower_inst) {
+        const ARM64Reg lower_result = ctx.reg_alloc.ScratchFpr();
+
+        code.fp_emitter.MUL(esize, lower_result, x, y);
+
+        ctx.reg_alloc.DefineValue(lower_inst, lower_result);
+        ctx.EraseInstruction(lower_inst);
+    }
+}
+
+void EmitVectorSignedSaturatedDoublingMultiply(ESize esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    const auto upper_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetUpperFromOp);
+    const auto lower_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetLowerFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg x = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg y = ctx.reg_alloc.UseFpr(args[1]);
+
+    if (upper_inst) {
+        const ARM64Reg upper_result = ctx.reg_alloc.ScratchFpr();
+
+        // Saturation sets the host FPSR.QC, which is folded into the guest FPSR.
+        code.fp_emitter.SQDMULH(esize, upper_result, x, y);
+
+        ctx.reg_alloc.DefineValue(upper_inst, upper_result);
+        ctx.EraseInstruction(upper_inst);
+    }
+
+    if (lower_inst) {
+        const ARM64Reg lower_result = ctx.reg_alloc.ScratchFpr();
+
+        code.fp_emitter.MUL(esize, lower_result, x, y);
+        code.fp_emitter.ADD(esize, lower_result, lower_result, lower_result);
+
+        ctx.reg_alloc.DefineValue(lower_inst, lower_result);
+        ctx.EraseInstruction(lower_inst);
+    }
+}
+
+void EmitVectorPermute(u8 esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst,
+                       void (ARM64FloatEmitter::*fn)(u8, ARM64Reg, ARM64Reg, ARM64Reg)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    (code.fp_emitter.*fn)(esize, a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitVectorSaturatedAccumulate(ESize esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, TwoOpFn fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    // The second operand is the accumulator.
+    const ARM64Reg addend = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[1]);
+
+    (code.fp_emitter.*fn)(esize, result, addend);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitVectorSaturatedNarrow(u8 dest_size, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst,
+                               void (ARM64FloatEmitter::*fn)(u8, ARM64Reg, ARM64Reg)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    (code.fp_emitter.*fn)(dest_size, EncodeRegToDouble(a), a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+} // anonymous namespace
+
+void EmitA64::EmitVectorGetElement8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorGetElement(8, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorGetElement16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorGetElement(16, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorGetElement32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorGetElement(32, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorGetElement64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorGetElement(64, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSetElement8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSetElement(8, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSetElement16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSetElement(16, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSetElement32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSetElement(32, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSetElement64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSetElement(64, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorAbs8(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::ABS);
+}
+
+void EmitA64::EmitVectorAbs16(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::ABS);
+}
+
+void EmitA64::EmitVectorAbs32(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::ABS);
+}
+
+void EmitA64::EmitVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::ABS);
+}
+
+void EmitA64::EmitVectorAdd8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::ADD);
+}
+
+void EmitA64::EmitVectorAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::ADD);
+}
+
+void EmitA64::EmitVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::ADD);
+}
+
+void EmitA64::EmitVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::ADD);
+}
+
+void EmitA64::EmitVectorAnd(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.AND(a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorArithmeticShiftRight8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorArithmeticShiftRight(B, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorArithmeticShiftRight16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorArithmeticShiftRight(H, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorArithmeticShiftRight32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorArithmeticShiftRight(S, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorArithmeticShiftRight64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorArithmeticShiftRight(D, code, ctx, inst);
+}
+
+// SSHL and USHL shift by the signed lower byte of each element, exactly as the IR defines.
+void EmitA64::EmitVectorArithmeticVShift8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SSHL);
+}
+
+void EmitA64::EmitVectorArithmeticVShift16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SSHL);
+}
+
+void EmitA64::EmitVectorArithmeticVShift32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SSHL);
+}
+
+void EmitA64::EmitVectorArithmeticVShift64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::SSHL);
+}
+
+void EmitA64::EmitVectorBroadcastLower8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(8, true, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorBroadcastLower16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(16, true, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorBroadcastLower32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(32, true, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorBroadcast8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(8, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorBroadcast16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(16, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorBroadcast32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(32, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorBroadcast64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorBroadcast(64, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorCountLeadingZeros8(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::CLZ);
+}
+
+void EmitA64::EmitVectorCountLeadingZeros16(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::CLZ);
+}
+
+void EmitA64::EmitVectorCountLeadingZeros32(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::CLZ);
+}
+
+void EmitA64::EmitVectorDeinterleaveEven8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(8, code, ctx, inst, &ARM64FloatEmitter::UZP1);
+}
+
+void EmitA64::EmitVectorDeinterleaveEven16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(16, code, ctx, inst, &ARM64FloatEmitter::UZP1);
+}
+
+void EmitA64::EmitVectorDeinterleaveEven32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(32, code, ctx, inst, &ARM64FloatEmitter::UZP1);
+}
+
+void EmitA64::EmitVectorDeinterleaveEven64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(64, code, ctx, inst, &ARM64FloatEmitter::UZP1);
+}
+
+void EmitA64::EmitVectorDeinterleaveOdd8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(8, code, ctx, inst, &ARM64FloatEmitter::UZP2);
+}
+
+void EmitA64::EmitVectorDeinterleaveOdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(16, code, ctx, inst, &ARM64FloatEmitter::UZP2);
+}
+
+void EmitA64::EmitVectorDeinterleaveOdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(32, code, ctx, inst, &ARM64FloatEmitter::UZP2);
+}
+
+void EmitA64::EmitVectorDeinterleaveOdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(64, code, ctx, inst, &ARM64FloatEmitter::UZP2);
+}
+
+void EmitA64::EmitVectorEor(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.EOR(a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorEqual8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::CMEQ);
+}
+
+void EmitA64::EmitVectorEqual16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::CMEQ);
+}
+
+void EmitA64::EmitVectorEqual32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::CMEQ);
+}
+
+void EmitA64::EmitVectorEqual64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::CMEQ);
+}
+
+void EmitA64::EmitVectorEqual128(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg tmp = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.CMEQ(D, a, a, b);
+    code.fp_emitter.EXT(tmp, a, a, 8);
+    code.fp_emitter.AND(a, a, tmp);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorExtract(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    const u8 position = args[2].GetImmediateU8();
+    ASSERT(position % 8 == 0);
+
+    code.fp_emitter.EXT(a, a, b, position / 8);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorExtractLower(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = EncodeRegToDouble(ctx.reg_alloc.UseScratchFpr(args[0]));
+    const ARM64Reg b = EncodeRegToDouble(ctx.reg_alloc.UseFpr(args[1]));
+
+    const u8 position = args[2].GetImmediateU8();
+    ASSERT(position % 8 == 0);
+
+    code.fp_emitter.EXT(a, a, b, position / 8);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorGreaterS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::CMGT);
+}
+
+void EmitA64::EmitVectorGreaterS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::CMGT);
+}
+
+void EmitA64::EmitVectorGreaterS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::CMGT);
+}
+
+void EmitA64::EmitVectorGreaterS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::CMGT);
+}
+
+void EmitA64::EmitVectorHalvingAddS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SHADD);
+}
+
+void EmitA64::EmitVectorHalvingAddS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SHADD);
+}
+
+void EmitA64::EmitVectorHalvingAddS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SHADD);
+}
+
+void EmitA64::EmitVectorHalvingAddU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UHADD);
+}
+
+void EmitA64::EmitVectorHalvingAddU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UHADD);
+}
+
+void EmitA64::EmitVectorHalvingAddU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UHADD);
+}
+
+void EmitA64::EmitVectorHalvingSubS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SHSUB);
+}
+
+void EmitA64::EmitVectorHalvingSubS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SHSUB);
+}
+
+void EmitA64::EmitVectorHalvingSubS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SHSUB);
+}
+
+void EmitA64::EmitVectorHalvingSubU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UHSUB);
+}
+
+void EmitA64::EmitVectorHalvingSubU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UHSUB);
+}
+
+void EmitA64::EmitVectorHalvingSubU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UHSUB);
+}
+
+void EmitA64::EmitVectorInterleaveLower8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(8, code, ctx, inst, &ARM64FloatEmitter::ZIP1);
+}
+
+void EmitA64::EmitVectorInterleaveLower16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(16, code, ctx, inst, &ARM64FloatEmitter::ZIP1);
+}
+
+void EmitA64::EmitVectorInterleaveLower32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(32, code, ctx, inst, &ARM64FloatEmitter::ZIP1);
+}
+
+void EmitA64::EmitVectorInterleaveLower64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(64, code, ctx, inst, &ARM64FloatEmitter::ZIP1);
+}
+
+void EmitA64::EmitVectorInterleaveUpper8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(8, code, ctx, inst, &ARM64FloatEmitter::ZIP2);
+}
+
+void EmitA64::EmitVectorInterleaveUpper16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(16, code, ctx, inst, &ARM64FloatEmitter::ZIP2);
+}
+
+void EmitA64::EmitVectorInterleaveUpper32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(32, code, ctx, inst, &ARM64FloatEmitter::ZIP2);
+}
+
+void EmitA64::EmitVectorInterleaveUpper64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorPermute(64, code, ctx, inst, &ARM64FloatEmitter::ZIP2);
+}
+
+void EmitA64::EmitVectorLogicalShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftLeft(B, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftLeft(H, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftLeft(S, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftLeft(D, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftRight8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftRight(B, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftRight16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftRight(H, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftRight32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftRight(S, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalShiftRight64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLogicalShiftRight(D, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorLogicalVShift8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::USHL);
+}
+
+void EmitA64::EmitVectorLogicalVShift16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::USHL);
+}
+
+void EmitA64::EmitVectorLogicalVShift32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::USHL);
+}
+
+void EmitA64::EmitVectorLogicalVShift64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::USHL);
+}
+
+void EmitA64::EmitVectorMaxS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SMAX);
+}
+
+void EmitA64::EmitVectorMaxS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SMAX);
+}
+
+void EmitA64::EmitVectorMaxS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SMAX);
+}
+
+void EmitA64::EmitVectorMaxS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMinMax64(true, true, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorMaxU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UMAX);
+}
+
+void EmitA64::EmitVectorMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UMAX);
+}
+
+void EmitA64::EmitVectorMaxU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UMAX);
+}
+
+void EmitA64::EmitVectorMaxU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMinMax64(false, true, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorMinS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SMIN);
+}
+
+void EmitA64::EmitVectorMinS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SMIN);
+}
+
+void EmitA64::EmitVectorMinS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SMIN);
+}
+
+void EmitA64::EmitVectorMinS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMinMax64(true, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorMinU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UMIN);
+}
+
+void EmitA64::EmitVectorMinU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UMIN);
+}
+
+void EmitA64::EmitVectorMinU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UMIN);
+}
+
+void EmitA64::EmitVectorMinU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMinMax64(false, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorMultiply8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::MUL);
+}
+
+void EmitA64::EmitVectorMultiply16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::MUL);
+}
+
+void EmitA64::EmitVectorMultiply32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::MUL);
+}
+
+void EmitA64::EmitVectorMultiply64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg tmp1 = ctx.reg_alloc.ScratchGpr();
+    const ARM64Reg tmp2 = ctx.reg_alloc.ScratchGpr();
+
+    // NEON has no 64-bit element multiply.
+    for (u8 i = 0; i < 2; i++) {
+        code.fp_emitter.UMOV(64, tmp1, a, i);
+        code.fp_emitter.UMOV(64, tmp2, b, i);
+        code.MUL(tmp1, tmp1, tmp2);
+        code.fp_emitter.INS(64, a, i, tmp1);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorNarrow16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.XTN(8, EncodeRegToDouble(a), a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorNarrow32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.XTN(16, EncodeRegToDouble(a), a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorNarrow64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.XTN(32, EncodeRegToDouble(a), a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorNot(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.NOT(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorOr(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.ORR(a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorPairedAddLower8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLowerOperation(code, ctx, inst, B, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedAddLower16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLowerOperation(code, ctx, inst, H, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedAddLower32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorLowerOperation(code, ctx, inst, S, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedAddSignedWiden8(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SADDLP);
+}
+
+void EmitA64::EmitVectorPairedAddSignedWiden16(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SADDLP);
+}
+
+void EmitA64::EmitVectorPairedAddSignedWiden32(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SADDLP);
+}
+
+void EmitA64::EmitVectorPairedAddUnsignedWiden8(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UADDLP);
+}
+
+void EmitA64::EmitVectorPairedAddUnsignedWiden16(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UADDLP);
+}
+
+void EmitA64::EmitVectorPairedAddUnsignedWiden32(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UADDLP);
+}
+
+void EmitA64::EmitVectorPairedAdd8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::ADDP);
+}
+
+void EmitA64::EmitVectorPairedMaxS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SMAXP);
+}
+
+void EmitA64::EmitVectorPairedMaxS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SMAXP);
+}
+
+void EmitA64::EmitVectorPairedMaxS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SMAXP);
+}
+
+void EmitA64::EmitVectorPairedMaxU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UMAXP);
+}
+
+void EmitA64::EmitVectorPairedMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UMAXP);
+}
+
+void EmitA64::EmitVectorPairedMaxU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UMAXP);
+}
+
+void EmitA64::EmitVectorPairedMinS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SMINP);
+}
+
+void EmitA64::EmitVectorPairedMinS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SMINP);
+}
+
+void EmitA64::EmitVectorPairedMinS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SMINP);
+}
+
+void EmitA64::EmitVectorPairedMinU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UMINP);
+}
+
+void EmitA64::EmitVectorPairedMinU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UMINP);
+}
+
+void EmitA64::EmitVectorPairedMinU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UMINP);
+}
+
+void EmitA64::EmitVectorPolynomialMultiply8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.PMUL(a, a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorPolynomialMultiplyLong8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.PMULL(B, a, EncodeRegToDouble(a), EncodeRegToDouble(b));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+static void PolynomialMultiplyLong64(std::array<u64, 2>& result, u64 lhs, u64 rhs) {
+    result = {};
+    for (size_t i = 0; i < 64; i++) {
+        if (Common::Bit(i, lhs)) {
+            result[0] ^= rhs << i;
+            result[1] ^= i == 0 ? 0 : rhs >> (64 - i);
+        }
+    }
+}
+
+void EmitA64::EmitVectorPolynomialMultiplyLong64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(HostFeature::PMULL)) {
+        const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+        const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+        code.fp_emitter.PMULL(D, a, EncodeRegToDouble(a), EncodeRegToDouble(b));
+
+        ctx.reg_alloc.DefineValue(inst, a);
+        return;
+    }
+
+    constexpr u32 stack_space = static_cast<u32>(sizeof(std::array<u64, 2>));
+    const ARM64Reg a = ctx.reg_alloc.UseFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.fp_emitter.UMOV(64, code.ABI_PARAM2, a, 0);
+    code.fp_emitter.UMOV(64, code.ABI_PARAM3, b, 0);
+    code.SUB(SP, SP, stack_space);
+    code.ADD(code.ABI_PARAM1, SP, 0);
+
+    code.QuickCallFunction(&PolynomialMultiplyLong64);
+
+    code.fp_emitter.LDR(128, INDEX_UNSIGNED, result, SP, 0);
+    code.ADD(SP, SP, stack_space);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitVectorPopulationCount(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.CNT(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorReverseBits(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.RBIT(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorRoundingHalvingAddS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SRHADD);
+}
+
+void EmitA64::EmitVectorRoundingHalvingAddS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SRHADD);
+}
+
+void EmitA64::EmitVectorRoundingHalvingAddS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SRHADD);
+}
+
+void EmitA64::EmitVectorRoundingHalvingAddU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::URHADD);
+}
+
+void EmitA64::EmitVectorRoundingHalvingAddU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::URHADD);
+}
+
+void EmitA64::EmitVectorRoundingHalvingAddU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::URHADD);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SRSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SRSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SRSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::SRSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::URSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::URSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::URSHL);
+}
+
+void EmitA64::EmitVectorRoundingShiftLeftU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::URSHL);
+}
+
+// The shuffles take x86 pshufd/pshuflw/pshufhw style selectors; each lane is an element move.
+void EmitA64::EmitVectorShuffleHighHalfwords(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg operand = ctx.reg_alloc.UseFpr(args[0]);
+    const u8 mask = args[1].GetImmediateU8();
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.MOV(result, operand);
+    for (u8 i = 0; i < 4; i++) {
+        code.fp_emitter.INS(16, result, 4 + i, operand, 4 + ((mask >> (i * 2)) & 0b11));
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitVectorShuffleLowHalfwords(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg operand = ctx.reg_alloc.UseFpr(args[0]);
+    const u8 mask = args[1].GetImmediateU8();
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.MOV(result, operand);
+    for (u8 i = 0; i < 4; i++) {
+        code.fp_emitter.INS(16, result, i, operand, (mask >> (i * 2)) & 0b11);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitVectorShuffleWords(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg operand = ctx.reg_alloc.UseFpr(args[0]);
+    const u8 mask = args[1].GetImmediateU8();
+    const ARM64Reg result = ctx.reg_alloc.ScratchFpr();
+
+    for (u8 i = 0; i < 4; i++) {
+        code.fp_emitter.INS(32, result, i, operand, (mask >> (i * 2)) & 0b11);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitVectorSignExtend8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.SXTL(8, a, EncodeRegToDouble(a));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorSignExtend16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.SXTL(16, a, EncodeRegToDouble(a));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorSignExtend32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.SXTL(32, a, EncodeRegToDouble(a));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorSignExtend64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg sign = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.SSHR(D, sign, a, 64);
+    code.fp_emitter.ZIP1(64, a, a, sign);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorSignedAbsoluteDifference8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SABD);
+}
+
+void EmitA64::EmitVectorSignedAbsoluteDifference16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SABD);
+}
+
+void EmitA64::EmitVectorSignedAbsoluteDifference32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SABD);
+}
+
+void EmitA64::EmitVectorSignedMultiply16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMultiplyUpperAndLower(H, true, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSignedMultiply32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMultiplyUpperAndLower(S, true, code, ctx, inst);
+}
+
+// The saturating operations below set the host FPSR.QC, which is folded into the guest FPSR.
+void EmitA64::EmitVectorSignedSaturatedAbs8(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SQABS);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAbs16(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SQABS);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAbs32(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SQABS);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAbs64(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::SQABS);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAccumulateUnsigned8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(B, code, ctx, inst, &ARM64FloatEmitter::SUQADD);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAccumulateUnsigned16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(H, code, ctx, inst, &ARM64FloatEmitter::SUQADD);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAccumulateUnsigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(S, code, ctx, inst, &ARM64FloatEmitter::SUQADD);
+}
+
+void EmitA64::EmitVectorSignedSaturatedAccumulateUnsigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(D, code, ctx, inst, &ARM64FloatEmitter::SUQADD);
+}
+
+void EmitA64::EmitVectorSignedSaturatedDoublingMultiply16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedDoublingMultiply(H, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSignedSaturatedDoublingMultiply32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedDoublingMultiply(S, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorSignedSaturatedDoublingMultiplyLong16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.SQDMULL(H, a, EncodeRegToDouble(a), EncodeRegToDouble(b));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorSignedSaturatedDoublingMultiplyLong32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg b = ctx.reg_alloc.UseFpr(args[1]);
+
+    code.fp_emitter.SQDMULL(S, a, EncodeRegToDouble(a), EncodeRegToDouble(b));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNarrowToSigned16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(8, code, ctx, inst, &ARM64FloatEmitter::SQXTN);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNarrowToSigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(16, code, ctx, inst, &ARM64FloatEmitter::SQXTN);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNarrowToSigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(32, code, ctx, inst, &ARM64FloatEmitter::SQXTN);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNarrowToUnsigned16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(8, code, ctx, inst, &ARM64FloatEmitter::SQXTUN);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNarrowToUnsigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(16, code, ctx, inst, &ARM64FloatEmitter::SQXTUN);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNarrowToUnsigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(32, code, ctx, inst, &ARM64FloatEmitter::SQXTUN);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNeg8(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SQNEG);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNeg16(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SQNEG);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNeg32(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SQNEG);
+}
+
+void EmitA64::EmitVectorSignedSaturatedNeg64(EmitContext& ctx, IR::Inst* inst) {
+    EmitOneArgumentVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::SQNEG);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SQSHL);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SQSHL);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SQSHL);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::SQSHL);
+}
+
+static void EmitVectorSignedSaturatedShiftLeftUnsigned(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, ESize esize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg data = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg shift = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg negative = ctx.reg_alloc.ScratchFpr();
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+
+    // Negative elements saturate to zero. UQSHL sees them as large unsigned values, so they are cleared
+    // afterwards, and saturating their all-ones mask with itself sets QC for them.
+    code.fp_emitter.SSHR(esize, negative, data, esize_bits - 1);
+    code.fp_emitter.UQSHL(esize, data, data, shift);
+    code.fp_emitter.BIC(data, data, negative);
+    code.fp_emitter.UQADD(esize, negative, negative, negative);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeftUnsigned8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedShiftLeftUnsigned(code, ctx, inst, B);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeftUnsigned16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedShiftLeftUnsigned(code, ctx, inst, H);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeftUnsigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedShiftLeftUnsigned(code, ctx, inst, S);
+}
+
+void EmitA64::EmitVectorSignedSaturatedShiftLeftUnsigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedShiftLeftUnsigned(code, ctx, inst, D);
+}
+
+void EmitA64::EmitVectorSub8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::SUB);
+}
+
+void EmitA64::EmitVectorSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::SUB);
+}
+
+void EmitA64::EmitVectorSub32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::SUB);
+}
+
+void EmitA64::EmitVectorSub64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::SUB);
+}
+
+void EmitA64::EmitVectorTable(EmitContext&, IR::Inst* inst) {
+    // Do nothing. We *want* to hold on to the refcount for our arguments, so VectorTableLookup can use our arguments.
+    ASSERT_MSG(inst->UseCount() == 1, "Table cannot be used multiple times");
+}
+
+void EmitA64::EmitVectorTableLookup(EmitContext& ctx, IR::Inst* inst) {
+    ASSERT(inst->GetArg(1).GetInst()->GetOpcode() == IR::Opcode::VectorTable);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto table = ctx.reg_alloc.GetArgumentInfo(inst->GetArg(1).GetInst());
+
+    const size_t table_size = std::count_if(table.begin(), table.end(), [](const auto& elem){ return !elem.IsVoid(); });
+
+    // TBX takes its table from consecutive registers. Out-of-range indices keep the defaults.
+    static constexpr std::array<HostLoc, 4> table_locations{HostLoc::Q0, HostLoc::Q1, HostLoc::Q2, HostLoc::Q3};
+    for (size_t i = 0; i < table_size; ++i) {
+        ctx.reg_alloc.Use(table[i], table_locations[i]);
+    }
+
+    const ARM64Reg indices = ctx.reg_alloc.UseFpr(args[2]);
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.TBX(result, Q0, static_cast<u8>(table_size), indices);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitVectorUnsignedAbsoluteDifference8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UABD);
+}
+
+void EmitA64::EmitVectorUnsignedAbsoluteDifference16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UABD);
+}
+
+void EmitA64::EmitVectorUnsignedAbsoluteDifference32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UABD);
+}
+
+void EmitA64::EmitVectorUnsignedMultiply16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMultiplyUpperAndLower(H, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorUnsignedMultiply32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorMultiplyUpperAndLower(S, false, code, ctx, inst);
+}
+
+void EmitA64::EmitVectorUnsignedRecipEstimate(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.URECPE(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorUnsignedRecipSqrtEstimate(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.URSQRTE(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedAccumulateSigned8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(B, code, ctx, inst, &ARM64FloatEmitter::USQADD);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedAccumulateSigned16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(H, code, ctx, inst, &ARM64FloatEmitter::USQADD);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedAccumulateSigned32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(S, code, ctx, inst, &ARM64FloatEmitter::USQADD);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedAccumulateSigned64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedAccumulate(D, code, ctx, inst, &ARM64FloatEmitter::USQADD);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedNarrow16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(8, code, ctx, inst, &ARM64FloatEmitter::UQXTN);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedNarrow32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(16, code, ctx, inst, &ARM64FloatEmitter::UQXTN);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedNarrow64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSaturatedNarrow(32, code, ctx, inst, &ARM64FloatEmitter::UQXTN);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, B, &ARM64FloatEmitter::UQSHL);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, H, &ARM64FloatEmitter::UQSHL);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, S, &ARM64FloatEmitter::UQSHL);
+}
+
+void EmitA64::EmitVectorUnsignedSaturatedShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, D, &ARM64FloatEmitter::UQSHL);
+}
+
+void EmitA64::EmitVectorZeroExtend8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.UXTL(8, a, EncodeRegToDouble(a));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorZeroExtend16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.UXTL(16, a, EncodeRegToDouble(a));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorZeroExtend32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    code.fp_emitter.UXTL(32, a, EncodeRegToDouble(a));
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorZeroExtend64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = EncodeRegToDouble(ctx.reg_alloc.UseScratchFpr(args[0]));
+
+    code.fp_emitter.MOV(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitVectorZeroUpper(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const ARM64Reg a = EncodeRegToDouble(ctx.reg_alloc.UseScratchFpr(args[0]));
+
+    code.fp_emitter.MOV(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitA64::EmitZeroVector(EmitContext& ctx, IR::Inst* inst) {
+    const ARM64Reg a = ctx.reg_alloc.ScratchFpr();
+
+    code.fp_emitter.EOR(a, a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+} // namespace Dynarmic::BackendA64
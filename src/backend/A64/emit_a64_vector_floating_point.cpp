@@ -0,0 +1,388 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "backend/A64/block_of_code.h"
+#include "backend/A64/emit_a64.h"
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "common/fp/rounding_mode.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+// The host FPCR holds the guest FPCR while JITted code runs, so the native instructions below
+// observe the guest's rounding, flush-to-zero and default NaN settings and accumulate the
+// guest's cumulative exception flags.
+
+namespace Dynarmic::BackendA64 {
+
+namespace {
+
+Arm64Gen::RoundingMode ConvertRoundingModeToA64RoundingMode(FP::RoundingMode rounding_mode) {
+    switch (rounding_mode) {
+    case FP::RoundingMode::ToNearest_TieEven:
+        return RoundingMode::ROUND_N;
+    case FP::RoundingMode::TowardsPlusInfinity:
+        return RoundingMode::ROUND_P;
+    case FP::RoundingMode::TowardsMinusInfinity:
+        return RoundingMode::ROUND_M;
+    case FP::RoundingMode::TowardsZero:
+        return RoundingMode::ROUND_Z;
+    case FP::RoundingMode::ToNearest_TieAwayFromZero:
+        return RoundingMode::ROUND_A;
+    default:
+        UNREACHABLE();
+    }
+}
+
+template <size_t fsize>
+void FPVectorTwoOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, void (ARM64FloatEmitter::*fn)(u8, ARM64Reg, ARM64Reg)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    (code.fp_emitter.*fn)(fsize, result, result);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <size_t fsize>
+void FPVectorThreeOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, void (ARM64FloatEmitter::*fn)(u8, ARM64Reg, ARM64Reg, ARM64Reg)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg operand = ctx.reg_alloc.UseFpr(args[1]);
+
+    (code.fp_emitter.*fn)(fsize, result, result, operand);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <size_t fsize>
+void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg addend = ctx.reg_alloc.UseScratchFpr(args[0]);
+    const ARM64Reg op1 = ctx.reg_alloc.UseFpr(args[1]);
+    const ARM64Reg op2 = ctx.reg_alloc.UseFpr(args[2]);
+
+    code.fp_emitter.FMLA(fsize, addend, op1, op2);
+
+    ctx.reg_alloc.DefineValue(inst, addend);
+}
+
+template <size_t fsize>
+void EmitFPVectorRoundInt(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const auto rounding = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
+    const bool exact = args[2].GetImmediateU1();
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    if (exact) {
+        // FRINTX rounds with the current FPCR mode and raises Inexact.
+        ASSERT(rounding == ctx.FPSCR_RMode());
+        code.fp_emitter.FRINTX(fsize, result, result);
+    } else {
+        code.fp_emitter.FRINT(fsize, result, result, ConvertRoundingModeToA64RoundingMode(rounding));
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <size_t fsize, bool unsigned_>
+void EmitFPVectorFromFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const size_t fbits = args[1].GetImmediateU8();
+    const auto rounding = static_cast<FP::RoundingMode>(args[2].GetImmediateU8());
+
+    // SCVTF and UCVTF round with the current FPCR mode.
+    ASSERT(rounding == ctx.FPSCR_RMode());
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    if (fbits != 0) {
+        if constexpr (unsigned_) {
+            code.fp_emitter.UCVTF(fsize, result, result, static_cast<int>(fbits));
+        } else {
+            code.fp_emitter.SCVTF(fsize, result, result, static_cast<int>(fbits));
+        }
+    } else {
+        if constexpr (unsigned_) {
+            code.fp_emitter.UCVTF(fsize, result, result);
+        } else {
+            code.fp_emitter.SCVTF(fsize, result, result);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <size_t fsize, bool unsigned_>
+void EmitFPVectorToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const size_t fbits = args[1].GetImmediateU8();
+    const auto rounding = static_cast<FP::RoundingMode>(args[2].GetImmediateU8());
+
+    const ARM64Reg result = ctx.reg_alloc.UseScratchFpr(args[0]);
+
+    if (fbits != 0 && rounding == FP::RoundingMode::TowardsZero) {
+        if constexpr (unsigned_) {
+            code.fp_emitter.FCVTZU(fsize, result, result, static_cast<int>(fbits));
+        } else {
+            code.fp_emitter.FCVTZS(fsize, result, result, static_cast<int>(fbits));
+        }
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (fbits != 0) {
+        // The fixed-point forms only round towards zero. Scaling by a power of two is exact
+        // short of overflowing to infinity, which saturates the conversion just the same.
+        const ARM64Reg scale = ctx.reg_alloc.ScratchFpr();
+        const ARM64Reg tmp = ctx.reg_alloc.ScratchGpr();
+
+        if constexpr (fsize == 32) {
+            code.MOVI2R(DecodeReg(tmp), static_cast<u32>(127 + fbits) << 23);
+            code.fp_emitter.DUP(32, scale, DecodeReg(tmp));
+        } else {
+            code.MOVI2R(tmp, static_cast<u64>(1023 + fbits) << 52);
+            code.fp_emitter.DUP(64, scale, tmp);
+        }
+        code.fp_emitter.FMUL(fsize, result, result, scale);
+    }
+
+    const auto round_imm = ConvertRoundingModeToA64RoundingMode(rounding);
+    if constexpr (unsigned_) {
+        code.fp_emitter.FCVTU(fsize, result, result, round_imm);
+    } else {
+        code.fp_emitter.FCVTS(fsize, result, result, round_imm);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+} // anonymous namespace
+
+void EmitA64::EmitFPVectorAbs32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<32>(code, ctx, inst, &ARM64FloatEmitter::FABS);
+}
+
+void EmitA64::EmitFPVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<64>(code, ctx, inst, &ARM64FloatEmitter::FABS);
+}
+
+void EmitA64::EmitFPVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FADD);
+}
+
+void EmitA64::EmitFPVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FADD);
+}
+
+void EmitA64::EmitFPVectorDiv32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FDIV);
+}
+
+void EmitA64::EmitFPVectorDiv64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FDIV);
+}
+
+void EmitA64::EmitFPVectorEqual32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FCMEQ);
+}
+
+void EmitA64::EmitFPVectorEqual64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FCMEQ);
+}
+
+void EmitA64::EmitFPVectorFromSignedFixed32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorFromFixed<32, false>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorFromSignedFixed64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorFromFixed<64, false>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorFromUnsignedFixed32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorFromFixed<32, true>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorFromUnsignedFixed64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorFromFixed<64, true>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorGreater32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FCMGT);
+}
+
+void EmitA64::EmitFPVectorGreater64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FCMGT);
+}
+
+void EmitA64::EmitFPVectorGreaterEqual32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FCMGE);
+}
+
+void EmitA64::EmitFPVectorGreaterEqual64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FCMGE);
+}
+
+void EmitA64::EmitFPVectorMax32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FMAX);
+}
+
+void EmitA64::EmitFPVectorMax64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FMAX);
+}
+
+void EmitA64::EmitFPVectorMin32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FMIN);
+}
+
+void EmitA64::EmitFPVectorMin64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FMIN);
+}
+
+void EmitA64::EmitFPVectorMul32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FMUL);
+}
+
+void EmitA64::EmitFPVectorMul64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FMUL);
+}
+
+void EmitA64::EmitFPVectorMulAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorMulAdd<32>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorMulAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorMulAdd<64>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorMulX32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FMULX);
+}
+
+void EmitA64::EmitFPVectorMulX64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FMULX);
+}
+
+void EmitA64::EmitFPVectorNeg32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<32>(code, ctx, inst, &ARM64FloatEmitter::FNEG);
+}
+
+void EmitA64::EmitFPVectorNeg64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<64>(code, ctx, inst, &ARM64FloatEmitter::FNEG);
+}
+
+void EmitA64::EmitFPVectorPairedAdd32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FADDP);
+}
+
+void EmitA64::EmitFPVectorPairedAdd64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FADDP);
+}
+
+void EmitA64::EmitFPVectorPairedAddLower32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = EncodeRegToDouble(ctx.reg_alloc.UseScratchFpr(args[0]));
+    const ARM64Reg operand = EncodeRegToDouble(ctx.reg_alloc.UseFpr(args[1]));
+
+    code.fp_emitter.FADDP(32, result, result, operand);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitFPVectorPairedAddLower64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const ARM64Reg result = EncodeRegToDouble(ctx.reg_alloc.UseScratchFpr(args[0]));
+    const ARM64Reg operand = EncodeRegToDouble(ctx.reg_alloc.UseFpr(args[1]));
+
+    // The single pair is the low element of each operand; a scalar write zeroes the upper lane.
+    code.fp_emitter.FADD(result, result, operand);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitA64::EmitFPVectorRecipEstimate32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<32>(code, ctx, inst, &ARM64FloatEmitter::FRECPE);
+}
+
+void EmitA64::EmitFPVectorRecipEstimate64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<64>(code, ctx, inst, &ARM64FloatEmitter::FRECPE);
+}
+
+void EmitA64::EmitFPVectorRecipStepFused32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FRECPS);
+}
+
+void EmitA64::EmitFPVectorRecipStepFused64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FRECPS);
+}
+
+void EmitA64::EmitFPVectorRoundInt32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorRoundInt<32>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorRoundInt64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorRoundInt<64>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorRSqrtEstimate32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<32>(code, ctx, inst, &ARM64FloatEmitter::FRSQRTE);
+}
+
+void EmitA64::EmitFPVectorRSqrtEstimate64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<64>(code, ctx, inst, &ARM64FloatEmitter::FRSQRTE);
+}
+
+void EmitA64::EmitFPVectorRSqrtStepFused32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FRSQRTS);
+}
+
+void EmitA64::EmitFPVectorRSqrtStepFused64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FRSQRTS);
+}
+
+void EmitA64::EmitFPVectorSqrt32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<32>(code, ctx, inst, &ARM64FloatEmitter::FSQRT);
+}
+
+void EmitA64::EmitFPVectorSqrt64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorTwoOp<64>(code, ctx, inst, &ARM64FloatEmitter::FSQRT);
+}
+
+void EmitA64::EmitFPVectorSub32(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<32>(code, ctx, inst, &ARM64FloatEmitter::FSUB);
+}
+
+void EmitA64::EmitFPVectorSub64(EmitContext& ctx, IR::Inst* inst) {
+    FPVectorThreeOp<64>(code, ctx, inst, &ARM64FloatEmitter::FSUB);
+}
+
+void EmitA64::EmitFPVectorToSignedFixed32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorToFixed<32, false>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorToSignedFixed64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorToFixed<64, false>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorToUnsignedFixed32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorToFixed<32, true>(code, ctx, inst);
+}
+
+void EmitA64::EmitFPVectorToUnsignedFixed64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorToFixed<64, true>(code, ctx, inst);
+}
+
+} // namespace Dynarmic::BackendA64
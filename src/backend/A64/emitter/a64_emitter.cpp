@@ -644,7 +644,8 @@ void ARM64XEmitter::EncodeData1SrcInst(u32 instenc, ARM64Reg Rd, ARM64Reg Rn) {
 }
 
 void ARM64XEmitter::EncodeData2SrcInst(u32 instenc, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
-    bool b64Bit = Is64Bit(Rd);
+    // CRC32X and CRC32CX take a 32-bit Rd with a 64-bit Rm.
+    bool b64Bit = Is64Bit(Rd) || Is64Bit(Rm);
 
     Rd = DecodeReg(Rd);
     Rm = DecodeReg(Rm);
@@ -682,14 +683,20 @@ void ARM64XEmitter::EncodeLoadRegisterInst(u32 bitop, ARM64Reg Rt, s32 imm) {
 
     ASSERT_MSG(IsInRangeImm19(imm), "{}: offset too large {}", __func__, imm);
 
-    Rt = DecodeReg(Rt);
-    if (b64Bit && bitop != 0x2) // LDRSW(0x2) uses 64bit reg, doesn't have 64bit bit set
+    if (bVec) {
+        // SIMD&FP literal loads encode the register size in opc: 00 = S, 01 = D, 10 = Q
+        ASSERT_MSG(bitop == 0, "{}: only LDR supports SIMD&FP registers", __func__);
+        bitop = IsQuad(Rt) ? 0x2 : IsDouble(Rt) ? 0x1 : 0x0;
+    } else if (b64Bit && bitop != 0x2) { // LDRSW(0x2) uses 64bit reg, doesn't have 64bit bit set
         bitop |= 0x1;
+    }
+
+    Rt = DecodeReg(Rt);
     Write32((bitop << 30) | (bVec << 26) | (0x18 << 24) | (MaskImm19(imm) << 5) | Rt);
 }
 
-void ARM64XEmitter::EncodeLoadStoreExcInst(u32 instenc, ARM64Reg Rs, ARM64Reg Rt2, ARM64Reg Rn,
-                                           ARM64Reg Rt) {
+void ARM64XEmitter::EncodeLoadStoreExcInst(u32 instenc, ARM64Reg Rs, ARM64Reg Rt2, ARM64Reg Rt,
+                                           ARM64Reg Rn) {
     Rs = DecodeReg(Rs);
     Rt2 = DecodeReg(Rt2);
     Rn = DecodeReg(Rn);
@@ -2033,6 +2040,27 @@ void ARM64FloatEmitter::EmitScalarThreeSame(bool U, u32 size, u32 opcode, ARM64R
             (opcode << 11) | (1 << 10) | (Rn << 5) | Rd);
 }
 
+void ARM64FloatEmitter::EmitScalarFPThreeSame(bool U, bool a, u32 opcode, ARM64Reg Rd, ARM64Reg Rn,
+                                              ARM64Reg Rm) {
+    ASSERT_MSG(!IsQuad(Rd), "%s doesn't support quads!", __func__);
+    const u32 sz = IsDouble(Rd) ? 1 : 0;
+    Rd = DecodeReg(Rd);
+    Rn = DecodeReg(Rn);
+    Rm = DecodeReg(Rm);
+
+    Write32((U << 29) | (0b1011110001 << 21) | (a << 23) | (sz << 22) | (Rm << 16) |
+            (opcode << 11) | (1 << 10) | (Rn << 5) | Rd);
+}
+
+void ARM64FloatEmitter::EmitScalar2RegMisc(bool U, u32 size, u32 opcode, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT_MSG(!IsQuad(Rd), "%s doesn't support quads!", __func__);
+    Rd = DecodeReg(Rd);
+    Rn = DecodeReg(Rn);
+
+    Write32((U << 29) | (0b1011110 << 24) | (size << 22) | (0b10000 << 17) | (opcode << 12) |
+            (0b10 << 10) | (Rn << 5) | Rd);
+}
+
 void ARM64FloatEmitter::EmitCopy(bool Q, u32 op, u32 imm5, u32 imm4, ARM64Reg Rd, ARM64Reg Rn) {
     Rd = DecodeReg(Rd);
     Rn = DecodeReg(Rn);
@@ -2041,6 +2069,17 @@ void ARM64FloatEmitter::EmitCopy(bool Q, u32 op, u32 imm5, u32 imm4, ARM64Reg Rd
             (Rn << 5) | Rd);
 }
 
+void ARM64FloatEmitter::EmitThreeDifferent(bool Q, bool U, u32 size, u32 opcode, ARM64Reg Rd,
+                                           ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT_MSG(IsQuad(Rd), "%s only supports quad destinations!", __func__);
+    Rd = DecodeReg(Rd);
+    Rn = DecodeReg(Rn);
+    Rm = DecodeReg(Rm);
+
+    Write32((Q << 30) | (U << 29) | (0b1110001 << 21) | (size << 22) | (Rm << 16) | (opcode << 12) |
+            (Rn << 5) | Rd);
+}
+
 void ARM64FloatEmitter::Emit2RegMisc(bool Q, bool U, u32 size, u32 opcode, ARM64Reg Rd,
                                      ARM64Reg Rn) {
     ASSERT_MSG(!IsSingle(Rd), "%s doesn't support singles!", __func__);
@@ -2155,6 +2194,32 @@ void ARM64FloatEmitter::EmitConvertScalarToInt(ARM64Reg Rd, ARM64Reg Rn, Roundin
     }
 }
 
+void ARM64FloatEmitter::EmitConvertVectorToInt(u8 size, ARM64Reg Rd, ARM64Reg Rn,
+                                               RoundingMode round, bool sign) {
+    u32 sz = size >> 6;
+    u32 opcode = 0;
+    switch (round) {
+    case ROUND_A:
+        opcode = 0x1C;
+        break;
+    case ROUND_P:
+        sz |= 2;
+        opcode = 0x1A;
+        break;
+    case ROUND_M:
+        opcode = 0x1B;
+        break;
+    case ROUND_Z:
+        sz |= 2;
+        opcode = 0x1B;
+        break;
+    case ROUND_N:
+        opcode = 0x1A;
+        break;
+    }
+    Emit2RegMisc(IsQuad(Rd), !sign, sz, opcode, Rd, Rn);
+}
+
 void ARM64FloatEmitter::FCVTS(ARM64Reg Rd, ARM64Reg Rn, RoundingMode round) {
     EmitConvertScalarToInt(Rd, Rn, round, false);
 }
@@ -2217,6 +2282,27 @@ void ARM64FloatEmitter::EmitPermute(u32 size, u32 op, ARM64Reg Rd, ARM64Reg Rn,
             (Rn << 5) | Rd);
 }
 
+void ARM64FloatEmitter::EmitTableLookup(u32 op, ARM64Reg Rd, ARM64Reg Rn, u8 table_size, ARM64Reg Rm) {
+    ASSERT_MSG(!IsSingle(Rd), "%s doesn't support singles!", __func__);
+    ASSERT_MSG(table_size >= 1 && table_size <= 4, "%s table size out of range!", __func__);
+    bool quad = IsQuad(Rd);
+    Rd = DecodeReg(Rd);
+    Rn = DecodeReg(Rn);
+    Rm = DecodeReg(Rm);
+
+    Write32((quad << 30) | (0xE << 24) | (Rm << 16) | ((table_size - 1) << 13) | (op << 12) |
+            (Rn << 5) | Rd);
+}
+
+void ARM64FloatEmitter::EmitCryptoAES(u32 opcode, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT_MSG(IsQuad(Rd) && IsQuad(Rn), "%s only supports quad registers!", __func__);
+
+    Rd = DecodeReg(Rd);
+    Rn = DecodeReg(Rn);
+
+    Write32((0x4E28 << 16) | (opcode << 12) | (2 << 10) | (Rn << 5) | Rd);
+}
+
 void ARM64FloatEmitter::EmitScalarImm(bool M, bool S, u32 type, u32 imm5, ARM64Reg Rd, u32 imm8) {
     ASSERT_MSG(!IsQuad(Rd), "%s doesn't support vector!", __func__);
 
@@ -2772,6 +2858,28 @@ void ARM64FloatEmitter::FNEG(ARM64Reg Rd, ARM64Reg Rn) {
 void ARM64FloatEmitter::FSQRT(ARM64Reg Rd, ARM64Reg Rn) {
     EmitScalar1Source(0, 0, IsDouble(Rd), 3, Rd, Rn);
 }
+void ARM64FloatEmitter::FRINT(ARM64Reg Rd, ARM64Reg Rn, RoundingMode round) {
+    switch (round) {
+    case ROUND_N:
+        EmitScalar1Source(0, 0, IsDouble(Rd), 8, Rd, Rn);
+        break;
+    case ROUND_P:
+        EmitScalar1Source(0, 0, IsDouble(Rd), 9, Rd, Rn);
+        break;
+    case ROUND_M:
+        EmitScalar1Source(0, 0, IsDouble(Rd), 10, Rd, Rn);
+        break;
+    case ROUND_Z:
+        EmitScalar1Source(0, 0, IsDouble(Rd), 11, Rd, Rn);
+        break;
+    case ROUND_A:
+        EmitScalar1Source(0, 0, IsDouble(Rd), 12, Rd, Rn);
+        break;
+    }
+}
+void ARM64FloatEmitter::FRINTX(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitScalar1Source(0, 0, IsDouble(Rd), 14, Rd, Rn);
+}
 
 // Scalar - 2 Source
 void ARM64FloatEmitter::FADD(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
@@ -2841,6 +2949,26 @@ void ARM64FloatEmitter::UQADD(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
 void ARM64FloatEmitter::UQSUB(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
     EmitScalarThreeSame(1, size, 0b00101, Rd, Rn, Rm);
 }
+void ARM64FloatEmitter::FMULX(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitScalarFPThreeSame(0, 0, 0b11011, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::FRECPS(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitScalarFPThreeSame(0, 0, 0b11111, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::FRSQRTS(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitScalarFPThreeSame(0, 1, 0b11111, Rd, Rn, Rm);
+}
+
+// Scalar two-register misc
+void ARM64FloatEmitter::FRECPE(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitScalar2RegMisc(0, 2 | IsDouble(Rd), 0b11101, Rd, Rn);
+}
+void ARM64FloatEmitter::FRECPX(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitScalar2RegMisc(0, 2 | IsDouble(Rd), 0b11111, Rd, Rn);
+}
+void ARM64FloatEmitter::FRSQRTE(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitScalar2RegMisc(1, 2 | IsDouble(Rd), 0b11101, Rd, Rn);
+}
 
 // Scalar floating point immediate
 void ARM64FloatEmitter::FMOV(ARM64Reg Rd, uint8_t imm8) {
@@ -3059,6 +3187,224 @@ void ARM64FloatEmitter::XTN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn) {
 void ARM64FloatEmitter::XTN2(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn) {
     Emit2RegMisc(true, 0, dest_size >> 4, 0b10010, Rd, Rn);
 }
+void ARM64FloatEmitter::ABS(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    Emit2RegMisc(IsQuad(Rd), 0, static_cast<u32>(esize), 0b01011, Rd, Rn);
+}
+void ARM64FloatEmitter::ADDP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(0, static_cast<u32>(esize), 0b10111, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::BIC(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(0, 1, 3, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::CLZ(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(esize != D);
+    Emit2RegMisc(IsQuad(Rd), 1, static_cast<u32>(esize), 0b00100, Rd, Rn);
+}
+void ARM64FloatEmitter::CMEQ(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(1, static_cast<u32>(esize), 0b10001, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::CNT(ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(IsQuad(Rd), 0, 0, 0b00101, Rd, Rn);
+}
+void ARM64FloatEmitter::EOR(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(1, 0, 3, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::EXT(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm, u8 index) {
+    ASSERT_MSG(!IsSingle(Rd), "%s doesn't support singles!", __func__);
+    bool quad = IsQuad(Rd);
+    ASSERT_MSG(index < (quad ? 16 : 8), "%s index out of range!", __func__);
+    Rd = DecodeReg(Rd);
+    Rn = DecodeReg(Rn);
+    Rm = DecodeReg(Rm);
+
+    Write32((quad << 30) | (0x2E << 24) | (Rm << 16) | (index << 11) | (Rn << 5) | Rd);
+}
+void ARM64FloatEmitter::TBL(ARM64Reg Rd, ARM64Reg Rn, u8 table_size, ARM64Reg Rm) {
+    EmitTableLookup(0, Rd, Rn, table_size, Rm);
+}
+void ARM64FloatEmitter::TBX(ARM64Reg Rd, ARM64Reg Rn, u8 table_size, ARM64Reg Rm) {
+    EmitTableLookup(1, Rd, Rn, table_size, Rm);
+}
+void ARM64FloatEmitter::FADDP(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(1, size >> 6, 0x1A, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::FCVTS(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round) {
+    EmitConvertVectorToInt(size, Rd, Rn, round, true);
+}
+void ARM64FloatEmitter::FCVTU(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round) {
+    EmitConvertVectorToInt(size, Rd, Rn, round, false);
+}
+void ARM64FloatEmitter::FMULX(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(0, size >> 6, 0x1B, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::FRECPS(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(0, size >> 6, 0x1F, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::FRINT(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round) {
+    switch (round) {
+    case ROUND_A:
+        Emit2RegMisc(IsQuad(Rd), 1, size >> 6, 0x18, Rd, Rn);
+        break;
+    case ROUND_P:
+        Emit2RegMisc(IsQuad(Rd), 0, 2 | (size >> 6), 0x18, Rd, Rn);
+        break;
+    case ROUND_M:
+        Emit2RegMisc(IsQuad(Rd), 0, size >> 6, 0x19, Rd, Rn);
+        break;
+    case ROUND_Z:
+        Emit2RegMisc(IsQuad(Rd), 0, 2 | (size >> 6), 0x19, Rd, Rn);
+        break;
+    case ROUND_N:
+        Emit2RegMisc(IsQuad(Rd), 0, size >> 6, 0x18, Rd, Rn);
+        break;
+    }
+}
+void ARM64FloatEmitter::FRINTX(u8 size, ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(IsQuad(Rd), 1, size >> 6, 0x19, Rd, Rn);
+}
+void ARM64FloatEmitter::FRSQRTS(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(0, 2 | (size >> 6), 0x1F, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::FSQRT(u8 size, ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(IsQuad(Rd), 1, 2 | (size >> 6), 0x1F, Rd, Rn);
+}
+void ARM64FloatEmitter::MUL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(0, static_cast<u32>(esize), 0b10011, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::NEG(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    Emit2RegMisc(IsQuad(Rd), 1, static_cast<u32>(esize), 0b01011, Rd, Rn);
+}
+void ARM64FloatEmitter::ORN(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(0, 3, 3, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::PMUL(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    EmitThreeSame(1, 0, 0b10011, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::PMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT_MSG(src_esize == B || src_esize == D, "%s only supports 8bit or 64bit sources!", __func__);
+    EmitThreeDifferent(false, 0, static_cast<u32>(src_esize), 0b1110, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::RBIT(ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(IsQuad(Rd), 1, 1, 0b00101, Rd, Rn);
+}
+void ARM64FloatEmitter::SADDLP(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(src_esize != D);
+    Emit2RegMisc(IsQuad(Rd), 0, static_cast<u32>(src_esize), 0b00010, Rd, Rn);
+}
+void ARM64FloatEmitter::UADDLP(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(src_esize != D);
+    Emit2RegMisc(IsQuad(Rd), 1, static_cast<u32>(src_esize), 0b00010, Rd, Rn);
+}
+void ARM64FloatEmitter::SMAX(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(0, static_cast<u32>(esize), 0b01100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::UMAX(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(1, static_cast<u32>(esize), 0b01100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SMAXP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(0, static_cast<u32>(esize), 0b10100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::UMAXP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(1, static_cast<u32>(esize), 0b10100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SMINP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(0, static_cast<u32>(esize), 0b10101, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::UMINP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(1, static_cast<u32>(esize), 0b10101, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SQABS(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    Emit2RegMisc(IsQuad(Rd), 0, static_cast<u32>(esize), 0b00111, Rd, Rn);
+}
+void ARM64FloatEmitter::SQNEG(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    Emit2RegMisc(IsQuad(Rd), 1, static_cast<u32>(esize), 0b00111, Rd, Rn);
+}
+void ARM64FloatEmitter::SQDMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT_MSG(src_esize == H || src_esize == S, "%s only supports 16bit or 32bit sources!", __func__);
+    EmitThreeDifferent(false, 0, static_cast<u32>(src_esize), 0b1101, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SQDMULH(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT_MSG(esize == H || esize == S, "%s only supports 16bit or 32bit elements!", __func__);
+    EmitThreeSame(0, static_cast<u32>(esize), 0b10110, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(src_esize != D);
+    EmitThreeDifferent(false, 0, static_cast<u32>(src_esize), 0b1100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SMULL2(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(src_esize != D);
+    EmitThreeDifferent(true, 0, static_cast<u32>(src_esize), 0b1100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::UMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(src_esize != D);
+    EmitThreeDifferent(false, 1, static_cast<u32>(src_esize), 0b1100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::UMULL2(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(src_esize != D);
+    EmitThreeDifferent(true, 1, static_cast<u32>(src_esize), 0b1100, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SQSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(0, static_cast<u32>(esize), 0b01001, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::UQSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(1, static_cast<u32>(esize), 0b01001, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SQXTUN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(false, 1, dest_size >> 4, 0b10010, Rd, Rn);
+}
+void ARM64FloatEmitter::SRHADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(0, static_cast<u32>(esize), 0b00010, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::URHADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(esize != D);
+    EmitThreeSame(1, static_cast<u32>(esize), 0b00010, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SRSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(0, static_cast<u32>(esize), 0b01010, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::URSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(1, static_cast<u32>(esize), 0b01010, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(0, static_cast<u32>(esize), 0b01000, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::USHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    EmitThreeSame(1, static_cast<u32>(esize), 0b01000, Rd, Rn, Rm);
+}
+void ARM64FloatEmitter::SUQADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    Emit2RegMisc(IsQuad(Rd), 0, static_cast<u32>(esize), 0b00011, Rd, Rn);
+}
+void ARM64FloatEmitter::USQADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    Emit2RegMisc(IsQuad(Rd), 1, static_cast<u32>(esize), 0b00011, Rd, Rn);
+}
+void ARM64FloatEmitter::URECPE(ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(IsQuad(Rd), 0, 2, 0b11100, Rd, Rn);
+}
+void ARM64FloatEmitter::URSQRTE(ARM64Reg Rd, ARM64Reg Rn) {
+    Emit2RegMisc(IsQuad(Rd), 1, 2, 0b11100, Rd, Rn);
+}
 
 // Move
 void ARM64FloatEmitter::DUP(u8 size, ARM64Reg Rd, ARM64Reg Rn) {
@@ -3299,6 +3645,20 @@ void ARM64FloatEmitter::ZIP2(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm) {
     EmitPermute(size, 0b111, Rd, Rn, Rm);
 }
 
+// Cryptographic AES
+void ARM64FloatEmitter::AESE(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitCryptoAES(0b00100, Rd, Rn);
+}
+void ARM64FloatEmitter::AESD(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitCryptoAES(0b00101, Rd, Rn);
+}
+void ARM64FloatEmitter::AESMC(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitCryptoAES(0b00110, Rd, Rn);
+}
+void ARM64FloatEmitter::AESIMC(ARM64Reg Rd, ARM64Reg Rn) {
+    EmitCryptoAES(0b00111, Rd, Rn);
+}
+
 // Shift by immediate
 void ARM64FloatEmitter::SSHLL(u8 src_size, ARM64Reg Rd, ARM64Reg Rn, u32 shift) {
     SSHLL(src_size, Rd, Rn, shift, false);
@@ -3331,6 +3691,36 @@ void ARM64FloatEmitter::UXTL2(u8 src_size, ARM64Reg Rd, ARM64Reg Rn) {
     UXTL(src_size, Rd, Rn, true);
 }
 
+void ARM64FloatEmitter::SHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, u32 shift) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+    ASSERT_MSG(shift < esize_bits, "%s shift amount must less than the element size!", __func__);
+    const u32 imm = esize_bits + shift;
+    EmitShiftImm(IsQuad(Rd), 0, imm >> 3, imm & 7, 0b01010, Rd, Rn);
+}
+void ARM64FloatEmitter::SSHR(ESize esize, ARM64Reg Rd, ARM64Reg Rn, u32 shift) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+    ASSERT_MSG(shift >= 1 && shift <= esize_bits, "%s shift amount out of range!", __func__);
+    const u32 imm = esize_bits * 2 - shift;
+    EmitShiftImm(IsQuad(Rd), 0, imm >> 3, imm & 7, 0b00000, Rd, Rn);
+}
+void ARM64FloatEmitter::USHR(ESize esize, ARM64Reg Rd, ARM64Reg Rn, u32 shift) {
+    ASSERT(!(IsDouble(Rd) && esize == D));
+    const u32 esize_bits = 8u << static_cast<u32>(esize);
+    ASSERT_MSG(shift >= 1 && shift <= esize_bits, "%s shift amount out of range!", __func__);
+    const u32 imm = esize_bits * 2 - shift;
+    EmitShiftImm(IsQuad(Rd), 1, imm >> 3, imm & 7, 0b00000, Rd, Rn);
+}
+void ARM64FloatEmitter::FCVTZS(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale) {
+    int imm = size * 2 - scale;
+    EmitShiftImm(IsQuad(Rd), 0, imm >> 3, imm & 7, 0x1F, Rd, Rn);
+}
+void ARM64FloatEmitter::FCVTZU(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale) {
+    int imm = size * 2 - scale;
+    EmitShiftImm(IsQuad(Rd), 1, imm >> 3, imm & 7, 0x1F, Rd, Rn);
+}
+
 void ARM64FloatEmitter::SSHLL(u8 src_size, ARM64Reg Rd, ARM64Reg Rn, u32 shift, bool upper) {
     ASSERT_MSG(shift < src_size, "%s shift amount must less than the element size!", __func__);
     u32 immh = 0;
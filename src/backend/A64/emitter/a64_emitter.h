@@ -484,7 +484,7 @@ private:
     void EncodeData3SrcInst(u32 instenc, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm, ARM64Reg Ra);
     void EncodeLogicalInst(u32 instenc, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm, ArithOption Shift);
     void EncodeLoadRegisterInst(u32 bitop, ARM64Reg Rt, s32 imm);
-    void EncodeLoadStoreExcInst(u32 instenc, ARM64Reg Rs, ARM64Reg Rt2, ARM64Reg Rn, ARM64Reg Rt);
+    void EncodeLoadStoreExcInst(u32 instenc, ARM64Reg Rs, ARM64Reg Rt2, ARM64Reg Rt, ARM64Reg Rn);
     void EncodeLoadStorePairedInst(u32 op, ARM64Reg Rt, ARM64Reg Rt2, ARM64Reg Rn, u32 imm);
     void EncodeLoadStoreIndexedInst(u32 op, u32 op2, ARM64Reg Rt, ARM64Reg Rn, s32 imm);
     void EncodeLoadStoreIndexedInst(u32 op, ARM64Reg Rt, ARM64Reg Rn, s32 imm, u8 size);
@@ -934,6 +934,8 @@ public:
     void FABS(ARM64Reg Rd, ARM64Reg Rn);
     void FNEG(ARM64Reg Rd, ARM64Reg Rn);
     void FSQRT(ARM64Reg Rd, ARM64Reg Rn);
+    void FRINT(ARM64Reg Rd, ARM64Reg Rn, RoundingMode round);
+    void FRINTX(ARM64Reg Rd, ARM64Reg Rn);
     void FMOV(ARM64Reg Rd, ARM64Reg Rn, bool top = false); // Also generalized move between GPR/FP
 
     // Scalar - 2 Source
@@ -958,6 +960,14 @@ public:
     void UQADD(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
     void SQSUB(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
     void UQSUB(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FMULX(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FRECPS(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FRSQRTS(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+
+    // Scalar two-register misc
+    void FRECPE(ARM64Reg Rd, ARM64Reg Rn);
+    void FRECPX(ARM64Reg Rd, ARM64Reg Rn);
+    void FRSQRTE(ARM64Reg Rd, ARM64Reg Rn);
     
     // Scalar floating point immediate
     void FMOV(ARM64Reg Rd, uint8_t imm8);
@@ -1024,6 +1034,60 @@ public:
     void UQXTN2(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
     void XTN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
     void XTN2(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
+    void ABS(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void ADDP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void BIC(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void CLZ(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void CMEQ(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void CNT(ARM64Reg Rd, ARM64Reg Rn);
+    void EOR(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void EXT(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm, u8 index);
+    void TBL(ARM64Reg Rd, ARM64Reg Rn, u8 table_size, ARM64Reg Rm);
+    void TBX(ARM64Reg Rd, ARM64Reg Rn, u8 table_size, ARM64Reg Rm);
+    void FADDP(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FCVTS(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round);
+    void FCVTU(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round);
+    void FMULX(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FRECPS(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FRINT(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round);
+    void FRINTX(u8 size, ARM64Reg Rd, ARM64Reg Rn);
+    void FRSQRTS(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void FSQRT(u8 size, ARM64Reg Rd, ARM64Reg Rn);
+    void MUL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void NEG(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void ORN(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void PMUL(ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void PMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void RBIT(ARM64Reg Rd, ARM64Reg Rn);
+    void SADDLP(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn);
+    void UADDLP(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn);
+    void SMAX(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void UMAX(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SMAXP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void UMAXP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SMINP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void UMINP(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SQABS(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void SQNEG(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void SQDMULH(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SQDMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SMULL2(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void UMULL(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void UMULL2(ESize src_esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SQSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void UQSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SQXTUN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
+    void SRHADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void URHADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SRSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void URSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SSHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void USHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void SUQADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void USQADD(ESize esize, ARM64Reg Rd, ARM64Reg Rn);
+    void URECPE(ARM64Reg Rd, ARM64Reg Rn);
+    void URSQRTE(ARM64Reg Rd, ARM64Reg Rn);
 
     // Move
     void DUP(u8 size, ARM64Reg Rd, ARM64Reg Rn);
@@ -1074,6 +1138,12 @@ public:
     void TRN2(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
     void ZIP2(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
 
+    // Cryptographic AES
+    void AESE(ARM64Reg Rd, ARM64Reg Rn);
+    void AESD(ARM64Reg Rd, ARM64Reg Rn);
+    void AESMC(ARM64Reg Rd, ARM64Reg Rn);
+    void AESIMC(ARM64Reg Rd, ARM64Reg Rn);
+
     // Shift by immediate
     void SSHLL(u8 src_size, ARM64Reg Rd, ARM64Reg Rn, u32 shift);
     void SSHLL2(u8 src_size, ARM64Reg Rd, ARM64Reg Rn, u32 shift);
@@ -1085,6 +1155,11 @@ public:
     void SXTL2(u8 src_size, ARM64Reg Rd, ARM64Reg Rn);
     void UXTL(u8 src_size, ARM64Reg Rd, ARM64Reg Rn);
     void UXTL2(u8 src_size, ARM64Reg Rd, ARM64Reg Rn);
+    void SHL(ESize esize, ARM64Reg Rd, ARM64Reg Rn, u32 shift);
+    void SSHR(ESize esize, ARM64Reg Rd, ARM64Reg Rn, u32 shift);
+    void USHR(ESize esize, ARM64Reg Rd, ARM64Reg Rn, u32 shift);
+    void FCVTZS(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale);
+    void FCVTZU(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale);
 
     // vector x indexed element
     void FMUL(u8 size, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm, u8 index);
@@ -1115,7 +1190,11 @@ private:
                            ARM64Reg Rm);
     void EmitThreeSame(bool U, u32 size, u32 opcode, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
     void EmitScalarThreeSame(bool U, u32 size, u32 opcode, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void EmitScalarFPThreeSame(bool U, bool a, u32 opcode, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void EmitScalar2RegMisc(bool U, u32 size, u32 opcode, ARM64Reg Rd, ARM64Reg Rn);
     void EmitCopy(bool Q, u32 op, u32 imm5, u32 imm4, ARM64Reg Rd, ARM64Reg Rn);
+    void EmitThreeDifferent(bool Q, bool U, u32 size, u32 opcode, ARM64Reg Rd, ARM64Reg Rn,
+                            ARM64Reg Rm);
     void Emit2RegMisc(bool Q, bool U, u32 size, u32 opcode, ARM64Reg Rd, ARM64Reg Rn);
     void EmitLoadStoreSingleStructure(bool L, bool R, u32 opcode, bool S, u32 size, ARM64Reg Rt,
                                       ARM64Reg Rn);
@@ -1128,6 +1207,8 @@ private:
     void EmitCompare(bool M, bool S, u32 op, u32 opcode2, ARM64Reg Rn, ARM64Reg Rm);
     void EmitCondSelect(bool M, bool S, CCFlags cond, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
     void EmitPermute(u32 size, u32 op, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm);
+    void EmitTableLookup(u32 op, ARM64Reg Rd, ARM64Reg Rn, u8 table_size, ARM64Reg Rm);
+    void EmitCryptoAES(u32 opcode, ARM64Reg Rd, ARM64Reg Rn);
     void EmitScalarImm(bool M, bool S, u32 type, u32 imm5, ARM64Reg Rd, u32 imm8);
     void EmitShiftImm(bool Q, bool U, u32 immh, u32 immb, u32 opcode, ARM64Reg Rd, ARM64Reg Rn);
     void EmitScalarShiftImm(bool U, u32 immh, u32 immb, u32 opcode, ARM64Reg Rd, ARM64Reg Rn);
@@ -1139,6 +1220,7 @@ private:
                             ARM64Reg Rm);
     void EmitLoadStoreUnscaled(u32 size, u32 op, ARM64Reg Rt, ARM64Reg Rn, s32 imm);
     void EmitConvertScalarToInt(ARM64Reg Rd, ARM64Reg Rn, RoundingMode round, bool sign);
+    void EmitConvertVectorToInt(u8 size, ARM64Reg Rd, ARM64Reg Rn, RoundingMode round, bool sign);
     void EmitScalar3Source(bool isDouble, ARM64Reg Rd, ARM64Reg Rn, ARM64Reg Rm, ARM64Reg Ra,
                            int opcode);
     void EncodeLoadStorePair(u32 size, bool load, IndexType type, ARM64Reg Rt, ARM64Reg Rt2,
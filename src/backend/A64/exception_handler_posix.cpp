@@ -8,7 +8,11 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include <csignal>
@@ -20,16 +24,20 @@
 #include "common/assert.h"
 #include "common/cast_util.h"
 #include "common/common_types.h"
+#include "common/scope_exit.h"
 
 namespace Dynarmic::BackendA64 {
 
 namespace {
 
 struct CodeBlockInfo {
-    BlockOfCode* block;
+    CodePtr code_begin, code_end;
     std::function<void(CodePtr)> callback;
 };
 
+/// Registered code blocks, sorted by code_begin. A published table is never modified.
+using CodeBlockTable = std::vector<CodeBlockInfo>;
+
 class SigHandler {
 public:
     SigHandler();
@@ -41,13 +49,23 @@ public:
     void RemoveCodeBlock(CodePtr PC);
 
 private:
-    auto FindCodeBlockInfo(CodePtr PC) {
-        return std::find_if(code_block_infos.begin(), code_block_infos.end(),
-                            [&](const CodeBlockInfo& x) { return x.block->GetRegion() <= PC && x.block->GetRegion() + x.block->GetRegionSize() > PC; });
+    static auto FindCodeBlockInfo(const CodeBlockTable& table, CodePtr PC) {
+        auto iter = std::upper_bound(table.begin(), table.end(), PC,
+                                     [](CodePtr PC, const CodeBlockInfo& x) { return PC < x.code_begin; });
+        if (iter == table.begin() || std::prev(iter)->code_end <= PC) {
+            return table.end();
+        }
+        return std::prev(iter);
     }
 
-    std::vector<CodeBlockInfo> code_block_infos;
-    std::mutex code_block_infos_mutex;
+    void PublishCodeBlockTable(std::unique_ptr<CodeBlockTable> new_table);
+
+    // The signal handler reads the current table without taking any locks. Writers, which are
+    // serialised by code_block_table_mutex, publish a modified copy of the table and free the
+    // previous one once no signal handler can still be reading it.
+    std::atomic<const CodeBlockTable*> code_block_table{new CodeBlockTable{}};
+    std::atomic<std::size_t> active_handlers{0};
+    std::mutex code_block_table_mutex;
 
     struct sigaction old_sa_segv;
     struct sigaction old_sa_bus;
@@ -60,8 +78,7 @@ SigHandler sig_handler;
 SigHandler::SigHandler() {
     // Method below from dolphin.
 
-    constexpr std::size_t signal_stack_size =
-        static_cast<std::size_t>(std::max(SIGSTKSZ, 2 * 1024 * 1024));
+    const std::size_t signal_stack_size = std::max<std::size_t>(SIGSTKSZ, 2 * 1024 * 1024);
 
     stack_t signal_stack;
     signal_stack.ss_sp = malloc(signal_stack_size);
@@ -76,34 +93,56 @@ SigHandler::SigHandler() {
     sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
     sigemptyset(&sa.sa_mask);
     sigaction(SIGSEGV, &sa, &old_sa_segv);
+    sigaction(SIGBUS, &sa, &old_sa_bus);
 }
 
 SigHandler::~SigHandler() {
     // No cleanup required.
 }
 
+void SigHandler::PublishCodeBlockTable(std::unique_ptr<CodeBlockTable> new_table) {
+    const std::unique_ptr<const CodeBlockTable> old_table{code_block_table.exchange(new_table.release())};
+
+    // A signal handler that started before the exchange may still be using the old table.
+    while (active_handlers.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
 void SigHandler::AddCodeBlock(CodeBlockInfo cb) {
-    std::lock_guard<std::mutex> guard(code_block_infos_mutex);
-    ASSERT(FindCodeBlockInfo(cb.block->GetRegion()) == code_block_infos.end());
-    code_block_infos.push_back(std::move(cb));
+    std::lock_guard<std::mutex> guard(code_block_table_mutex);
+    auto new_table = std::make_unique<CodeBlockTable>(*code_block_table.load());
+    ASSERT(FindCodeBlockInfo(*new_table, cb.code_begin) == new_table->end());
+    const auto insertion_point = std::upper_bound(new_table->begin(), new_table->end(), cb.code_begin,
+                                                  [](CodePtr code_begin, const CodeBlockInfo& x) { return code_begin < x.code_begin; });
+    new_table->insert(insertion_point, std::move(cb));
+    PublishCodeBlockTable(std::move(new_table));
 }
 
 void SigHandler::RemoveCodeBlock(CodePtr PC) {
-    std::lock_guard<std::mutex> guard(code_block_infos_mutex);
-    const auto iter = FindCodeBlockInfo(PC);
-    ASSERT(iter != code_block_infos.end());
-    code_block_infos.erase(iter);
+    std::lock_guard<std::mutex> guard(code_block_table_mutex);
+    auto new_table = std::make_unique<CodeBlockTable>(*code_block_table.load());
+    const auto iter = FindCodeBlockInfo(*new_table, PC);
+    ASSERT(iter != new_table->end());
+    new_table->erase(iter);
+    PublishCodeBlockTable(std::move(new_table));
 }
 
 void SigHandler::SigAction(int sig, siginfo_t* info, void* raw_context) {
     ASSERT(sig == SIGSEGV || sig == SIGBUS);
 
-    std::lock_guard<std::mutex> guard(sig_handler.code_block_infos_mutex);
     auto PC = reinterpret_cast<CodePtr>(((ucontext_t*)raw_context)->uc_mcontext.pc);
-    const auto iter = sig_handler.FindCodeBlockInfo(PC);
-    if (iter != sig_handler.code_block_infos.end()) {
-        iter->callback(PC);
-        return;
+
+    {
+        sig_handler.active_handlers++;
+        SCOPE_EXIT { sig_handler.active_handlers--; };
+
+        const CodeBlockTable& table = *sig_handler.code_block_table.load();
+        const auto iter = FindCodeBlockInfo(table, PC);
+        if (iter != table.end()) {
+            iter->callback(PC);
+            return;
+        }
     }
 
     fmt::print(
@@ -132,7 +171,7 @@ void SigHandler::SigAction(int sig, siginfo_t* info, void* raw_context) {
 struct ExceptionHandler::Impl final {
     Impl(BlockOfCode& code, std::function<void(CodePtr)> cb) {
         code_begin = code.GetRegion();
-        sig_handler.AddCodeBlock({&code, std::move(cb)});
+        sig_handler.AddCodeBlock({code_begin, code.GetRegion() + code.GetRegionSize(), std::move(cb)});
     }
 
     ~Impl() {
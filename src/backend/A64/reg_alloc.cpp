@@ -251,7 +251,7 @@ RegAlloc::ArgumentInfo RegAlloc::GetArgumentInfo(IR::Inst* inst) {
 Arm64Gen::ARM64Reg RegAlloc::UseGpr(Argument& arg) {
     ASSERT(!arg.allocated);
     arg.allocated = true;
-    return HostLocToReg64(UseImpl(arg.value, any_gpr));
+    return HostLocToReg64(UseImpl(arg.value, gpr_order));
 }
 
 Arm64Gen::ARM64Reg RegAlloc::UseFpr(Argument& arg) {
@@ -273,7 +273,7 @@ void RegAlloc::Use(Argument& arg, HostLoc host_loc) {
 Arm64Gen::ARM64Reg RegAlloc::UseScratchGpr(Argument& arg) {
     ASSERT(!arg.allocated);
     arg.allocated = true;
-    return HostLocToReg64(UseScratchImpl(arg.value, any_gpr));
+    return HostLocToReg64(UseScratchImpl(arg.value, gpr_order));
 }
 
 Arm64Gen::ARM64Reg RegAlloc::UseScratchFpr(Argument& arg) {
@@ -306,6 +306,10 @@ void RegAlloc::Release(const Arm64Gen::ARM64Reg& reg) {
     LocInfo(hostloc).ReleaseOne();
 }
 
+Arm64Gen::ARM64Reg RegAlloc::ScratchGpr() {
+    return HostLocToReg64(ScratchImpl(gpr_order));
+}
+
 Arm64Gen::ARM64Reg RegAlloc::ScratchGpr(HostLocList desired_locations) {
     return HostLocToReg64(ScratchImpl(desired_locations));
 }
@@ -314,7 +318,7 @@ Arm64Gen::ARM64Reg RegAlloc::ScratchFpr(HostLocList desired_locations) {
     return HostLocToFpr(ScratchImpl(desired_locations));
 }
 
-HostLoc RegAlloc::UseImpl(IR::Value use_value, HostLocList desired_locations) {
+HostLoc RegAlloc::UseImpl(IR::Value use_value, const std::vector<HostLoc>& desired_locations) {
     if (use_value.IsImmediate()) {
         return LoadImmediate(use_value, ScratchImpl(desired_locations));
     }
@@ -346,7 +350,7 @@ HostLoc RegAlloc::UseImpl(IR::Value use_value, HostLocList desired_locations) {
     return destination_location;
 }
 
-HostLoc RegAlloc::UseScratchImpl(IR::Value use_value, HostLocList desired_locations) {
+HostLoc RegAlloc::UseScratchImpl(IR::Value use_value, const std::vector<HostLoc>& desired_locations) {
     if (use_value.IsImmediate()) {
         return LoadImmediate(use_value, ScratchImpl(desired_locations));
     }
@@ -371,7 +375,7 @@ HostLoc RegAlloc::UseScratchImpl(IR::Value use_value, HostLocList desired_locati
     return destination_location;
 }
 
-HostLoc RegAlloc::ScratchImpl(HostLocList desired_locations) {
+HostLoc RegAlloc::ScratchImpl(const std::vector<HostLoc>& desired_locations) {
     HostLoc location = SelectARegister(desired_locations);
     MoveOutOfTheWay(location);
     LocInfo(location).WriteLock();
@@ -431,7 +435,7 @@ void RegAlloc::AssertNoMoreUses() {
     ASSERT(std::all_of(hostloc_info.begin(), hostloc_info.end(), [](const auto& i) { return i.IsEmpty(); }));
 }
 
-HostLoc RegAlloc::SelectARegister(HostLocList desired_locations) const {
+HostLoc RegAlloc::SelectARegister(const std::vector<HostLoc>& desired_locations) const {
      std::vector<HostLoc> candidates = desired_locations;
 
     // Find all locations that have not been allocated..
@@ -468,7 +472,7 @@ void RegAlloc::DefineValueImpl(IR::Inst* def_inst, const IR::Value& use_inst) {
     ASSERT_MSG(!ValueLocation(def_inst), "def_inst has already been defined");
 
     if (use_inst.IsImmediate()) {
-        HostLoc location = ScratchImpl(any_gpr);
+        HostLoc location = ScratchImpl(gpr_order);
         DefineValueImpl(def_inst, location);
         LoadImmediate(use_inst, location);
         return;
@@ -583,9 +587,7 @@ const HostLocInfo& RegAlloc::LocInfo(HostLoc loc) const {
 void RegAlloc::EmitMove(size_t bit_width, HostLoc to, HostLoc from) {
     if (HostLocIsFPR(to) && HostLocIsFPR(from)) {
         // bit_width == 128
-        //mov(HostLocToFpr(to), HostLocToFpr(from));
-
-        ASSERT_FALSE("Unimplemented");
+        code.fp_emitter.MOV(HostLocToFpr(to), HostLocToFpr(from));
     } else if (HostLocIsGPR(to) && HostLocIsGPR(from)) {
         ASSERT(bit_width != 128);
         if (bit_width == 64) {
@@ -96,8 +96,8 @@ class RegAlloc final {
 public:
     using ArgumentInfo = std::array<Argument, IR::max_arg_count>;
 
-    explicit RegAlloc(BlockOfCode& code, size_t num_spills, std::function<u64(HostLoc)> spill_to_addr)
-        : hostloc_info(NonSpillHostLocCount + num_spills), code(code), spill_to_addr(std::move(spill_to_addr)) {}
+    explicit RegAlloc(BlockOfCode& code, size_t num_spills, std::function<u64(HostLoc)> spill_to_addr, std::vector<HostLoc> gpr_order)
+        : gpr_order(std::move(gpr_order)), hostloc_info(NonSpillHostLocCount + num_spills), code(code), spill_to_addr(std::move(spill_to_addr)) {}
 
     ArgumentInfo GetArgumentInfo(IR::Inst* inst);
 
@@ -115,7 +115,8 @@ public:
 
     void Release(const Arm64Gen::ARM64Reg& reg);
 
-    Arm64Gen::ARM64Reg ScratchGpr(HostLocList desired_locations = any_gpr);
+    Arm64Gen::ARM64Reg ScratchGpr();
+    Arm64Gen::ARM64Reg ScratchGpr(HostLocList desired_locations);
     Arm64Gen::ARM64Reg ScratchFpr(HostLocList desired_locations = any_fpr);
 
     void HostCall(IR::Inst* result_def = nullptr, std::optional<Argument::copyable_reference> arg0 = {},
@@ -136,12 +137,14 @@ public:
 private:
     friend struct Argument;
 
-    HostLoc SelectARegister(HostLocList desired_locations) const;
+    std::vector<HostLoc> gpr_order;
+
+    HostLoc SelectARegister(const std::vector<HostLoc>& desired_locations) const;
     std::optional<HostLoc> ValueLocation(const IR::Inst* value) const;
 
-    HostLoc UseImpl(IR::Value use_value, HostLocList desired_locations);
-    HostLoc UseScratchImpl(IR::Value use_value, HostLocList desired_locations);
-    HostLoc ScratchImpl(HostLocList desired_locations);
+    HostLoc UseImpl(IR::Value use_value, const std::vector<HostLoc>& desired_locations);
+    HostLoc UseScratchImpl(IR::Value use_value, const std::vector<HostLoc>& desired_locations);
+    HostLoc ScratchImpl(const std::vector<HostLoc>& desired_locations);
     void DefineValueImpl(IR::Inst* def_inst, HostLoc host_loc);
     void DefineValueImpl(IR::Inst* def_inst, const IR::Value& use_inst);
 
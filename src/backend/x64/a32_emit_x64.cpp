@@ -88,7 +88,7 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
     code.EnableWriting();
     SCOPE_EXIT { code.DisableWriting(); };
 
-    static const std::vector<HostLoc> gpr_order = [this]{
+    const std::vector<HostLoc> gpr_order = [this]{
         std::vector<HostLoc> gprs{any_gpr};
         if (config.page_table) {
             gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R14));
@@ -242,6 +242,53 @@ void A32EmitX64::GenFastmemFallbacks() {
                 PerfMapRegister(write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a32_write_fallback_{}", bitsize));
             }
         }
+
+        // There are no 128-bit memory callbacks for A32, so 128-bit accesses fall back to a pair of
+        // 64-bit accesses. Their operands are kept on the stack across the calls.
+        const auto read_callback = Devirtualize<&A32::UserCallbacks::MemoryRead64>(config.callbacks);
+        const auto write_callback = Devirtualize<&A32::UserCallbacks::MemoryWrite64>(config.callbacks);
+
+        for (int value_idx = 0; value_idx < 16; value_idx++) {
+            code.align();
+            read_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(value_idx));
+            code.sub(rsp, 16 + ABI_SHADOW_SPACE);
+            if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+                code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+            }
+            code.mov(qword[rsp + ABI_SHADOW_SPACE + 8], code.ABI_PARAM2);
+            read_callback.EmitCall(code);
+            code.mov(qword[rsp + ABI_SHADOW_SPACE], code.ABI_RETURN);
+            code.mov(code.ABI_PARAM2.cvt32(), dword[rsp + ABI_SHADOW_SPACE + 8]);
+            code.add(code.ABI_PARAM2.cvt32(), 8);
+            read_callback.EmitCall(code);
+            code.mov(qword[rsp + ABI_SHADOW_SPACE + 8], code.ABI_RETURN);
+            code.movups(Xbyak::Xmm{value_idx}, xword[rsp + ABI_SHADOW_SPACE]);
+            code.add(rsp, 16 + ABI_SHADOW_SPACE);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(value_idx));
+            code.ret();
+            PerfMapRegister(read_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)], code.getCurr(), "a32_read_fallback_128");
+
+            code.align();
+            write_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
+            ABI_PushCallerSaveRegistersAndAdjustStack(code);
+            code.sub(rsp, 32 + ABI_SHADOW_SPACE);
+            code.movups(xword[rsp + ABI_SHADOW_SPACE], Xbyak::Xmm{value_idx});
+            if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+                code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+            }
+            code.mov(qword[rsp + ABI_SHADOW_SPACE + 16], code.ABI_PARAM2);
+            code.mov(code.ABI_PARAM3, qword[rsp + ABI_SHADOW_SPACE]);
+            write_callback.EmitCall(code);
+            code.mov(code.ABI_PARAM2.cvt32(), dword[rsp + ABI_SHADOW_SPACE + 16]);
+            code.add(code.ABI_PARAM2.cvt32(), 8);
+            code.mov(code.ABI_PARAM3, qword[rsp + ABI_SHADOW_SPACE + 8]);
+            write_callback.EmitCall(code);
+            code.add(rsp, 32 + ABI_SHADOW_SPACE);
+            ABI_PopCallerSaveRegistersAndAdjustStack(code);
+            code.ret();
+            PerfMapRegister(write_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)], code.getCurr(), "a32_write_fallback_128");
+        }
     }
 }
 
@@ -506,10 +553,7 @@ void A32EmitX64::EmitA32SetCpsrNZCVRaw(A32EmitContext& ctx, IR::Inst* inst) {
 void A32EmitX64::EmitA32SetCpsrNZCV(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Reg32 to_store = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
-    code.and_(to_store, 0b11000001'00000001);
-    code.imul(to_store, to_store, 0b00010000'00100001);
-    code.shl(to_store, 16);
-    code.and_(to_store, 0xF0000000);
+    code.and_(to_store, NZCV::x64_mask);
     code.mov(dword[r15 + offsetof(A32JitState, cpsr_nzcv)], to_store);
 }
 
@@ -677,6 +721,10 @@ void A32EmitX64::EmitA32DataMemoryBarrier(A32EmitContext&, IR::Inst*) {
     code.lfence();
 }
 
+void A32EmitX64::EmitA32OrderedAccessBarrier(A32EmitContext&, IR::Inst*) {
+    // Loads already have acquire semantics and stores release semantics on x86-64.
+}
+
 void A32EmitX64::EmitA32InstructionSynchronizationBarrier(A32EmitContext& ctx, IR::Inst*) {
     ctx.reg_alloc.HostCall(nullptr);
 
@@ -798,15 +846,6 @@ void A32EmitX64::EmitA32ClearExclusive(A32EmitContext&, IR::Inst*) {
     code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
 }
 
-void A32EmitX64::EmitA32SetExclusive(A32EmitContext& ctx, IR::Inst* inst) {
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ASSERT(args[1].IsImmediate());
-    const Xbyak::Reg32 address = ctx.reg_alloc.UseGpr(args[0]).cvt32();
-
-    code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(1));
-    code.mov(dword[r15 + offsetof(A32JitState, exclusive_address)], address);
-}
-
 std::optional<A32EmitX64::DoNotFastmemMarker> A32EmitX64::ShouldFastmem(A32EmitContext& ctx, IR::Inst* inst) const {
     if (!config.fastmem_pointer || !exception_handler.SupportsFastmem()) {
         return std::nullopt;
@@ -819,36 +858,64 @@ std::optional<A32EmitX64::DoNotFastmemMarker> A32EmitX64::ShouldFastmem(A32EmitC
     return marker;
 }
 
+void A32EmitX64::AddFastmemPatchInfo(FastmemPatchInfo info) {
+    // Code is mostly emitted at increasing addresses, so this is almost always an append.
+    const auto iter = std::upper_bound(fastmem_patch_info.begin(), fastmem_patch_info.end(), info.rip,
+                                       [](u64 rip, const FastmemPatchInfo& x) { return rip < x.rip; });
+    fastmem_patch_info.insert(iter, std::move(info));
+}
+
 FakeCall A32EmitX64::FastmemCallback(u64 rip_) {
-    const auto iter = fastmem_patch_info.find(rip_);
-    ASSERT(iter != fastmem_patch_info.end());
+    const auto iter = std::lower_bound(fastmem_patch_info.begin(), fastmem_patch_info.end(), rip_,
+                                       [](const FastmemPatchInfo& x, u64 rip) { return x.rip < rip; });
+    ASSERT(iter != fastmem_patch_info.end() && iter->rip == rip_);
     if (config.recompile_on_fastmem_failure) {
-        const auto marker = iter->second.marker;
+        const auto marker = iter->marker;
         do_not_fastmem.emplace(marker);
         InvalidateBasicBlocks({std::get<0>(marker)});
     }
     FakeCall ret;
-    ret.call_rip = iter->second.callback;
-    ret.ret_rip = iter->second.resume_rip;
+    ret.call_rip = iter->callback;
+    ret.ret_rip = iter->resume_rip;
     return ret;
 }
 
 static Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, RegAlloc& reg_alloc,
                                      const A32::UserConfig& config, Xbyak::Label& abort,
-                                     Xbyak::Reg64 vaddr,
-                                     std::optional<Xbyak::Reg64> arg_scratch = {}) {
+                                     Xbyak::Reg64 vaddr, size_t bitsize, bool is_write,
+                                     std::optional<Xbyak::Reg64> arg_scratch = {},
+                                     std::optional<Xbyak::Reg64> arg_tmp = {}) {
     constexpr size_t page_bits = A32::UserConfig::PAGE_BITS;
+    constexpr size_t page_size = 1 << page_bits;
+    constexpr size_t page_mask = page_size - 1;
     const Xbyak::Reg64 page = arg_scratch ? *arg_scratch : reg_alloc.ScratchGpr();
-    const Xbyak::Reg64 tmp = config.absolute_offset_page_table ? page : reg_alloc.ScratchGpr();
-    code.mov(tmp, vaddr);
+    const Xbyak::Reg64 tmp = config.absolute_offset_page_table ? page : arg_tmp ? *arg_tmp : reg_alloc.ScratchGpr();
+    if (bitsize >= 64) {
+        // 64-bit accesses may have been coalesced from 32-bit ones and 128-bit accesses come from
+        // multi-register loads and stores, so those that straddle a page boundary are sent to the
+        // memory callbacks.
+        code.mov(page.cvt32(), vaddr.cvt32());
+        code.and_(page.cvt32(), static_cast<u32>(page_mask));
+        code.cmp(page.cvt32(), static_cast<u32>(page_size - bitsize / 8));
+        code.ja(abort);
+    }
+    // Addresses taken from the low half of a 64-bit value may have garbage in their upper bits.
+    code.mov(tmp.cvt32(), vaddr.cvt32());
     code.shr(tmp, static_cast<int>(page_bits));
     code.mov(page, qword[r14 + tmp * sizeof(void*)]);
-    code.test(page, page);
+    if (config.page_table_attribute_bits) {
+        if (is_write) {
+            code.test(page, static_cast<u32>(A32::UserConfig::PAGE_ATTRIBUTE_MASK));
+            code.jnz(abort);
+        }
+        code.and_(page, ~static_cast<u32>(A32::UserConfig::PAGE_ATTRIBUTE_MASK));
+    } else {
+        code.test(page, page);
+    }
     code.jz(abort);
     if (config.absolute_offset_page_table) {
         return page + vaddr;
     }
-    constexpr size_t page_mask = (1 << page_bits) - 1;
     code.mov(tmp, vaddr);
     code.and_(tmp, static_cast<u32>(page_mask));
     return page + tmp;
@@ -882,6 +949,13 @@ void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
 
+    EmitReadMemoryAccess<bitsize>(ctx, inst, vaddr, value);
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+template<std::size_t bitsize>
+void A32EmitX64::EmitReadMemoryAccess(A32EmitContext& ctx, IR::Inst* inst, Xbyak::Reg64 vaddr, Xbyak::Reg64 value) {
     const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
 
     if (const auto marker = ShouldFastmem(ctx, inst)) {
@@ -905,23 +979,19 @@ void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
             break;
         }
 
-        ctx.reg_alloc.DefineValue(inst, value);
-
-        fastmem_patch_info.emplace(
+        AddFastmemPatchInfo(FastmemPatchInfo{
             Common::BitCast<u64>(location),
-            FastmemPatchInfo{
-                Common::BitCast<u64>(code.getCurr()),
-                Common::BitCast<u64>(wrapped_fn),
-                *marker,
-            }
-        );
+            Common::BitCast<u64>(code.getCurr()),
+            Common::BitCast<u64>(wrapped_fn),
+            *marker,
+        });
 
         return;
     }
 
     Xbyak::Label abort, end;
 
-    const auto src_ptr = EmitVAddrLookup(code, ctx.reg_alloc, config, abort, vaddr, value);
+    const auto src_ptr = EmitVAddrLookup(code, ctx.reg_alloc, config, abort, vaddr, bitsize, false, value);
     switch (bitsize) {
     case 8:
         code.movzx(value.cvt32(), code.byte[src_ptr]);
@@ -943,8 +1013,6 @@ void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
     code.L(abort);
     code.call(wrapped_fn);
     code.L(end);
-
-    ctx.reg_alloc.DefineValue(inst, value);
 }
 
 template<std::size_t bitsize>
@@ -975,6 +1043,12 @@ void A32EmitX64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
 
+    EmitWriteMemoryAccess<bitsize>(ctx, inst, vaddr, value);
+}
+
+template<std::size_t bitsize>
+void A32EmitX64::EmitWriteMemoryAccess(A32EmitContext& ctx, IR::Inst* inst, Xbyak::Reg64 vaddr, Xbyak::Reg64 value,
+                                       std::optional<Xbyak::Reg64> page, std::optional<Xbyak::Reg64> tmp) {
     const auto wrapped_fn = write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
 
     if (const auto marker = ShouldFastmem(ctx, inst)) {
@@ -998,21 +1072,19 @@ void A32EmitX64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
             break;
         }
 
-        fastmem_patch_info.emplace(
+        AddFastmemPatchInfo(FastmemPatchInfo{
             Common::BitCast<u64>(location),
-            FastmemPatchInfo{
-                Common::BitCast<u64>(code.getCurr()),
-                Common::BitCast<u64>(wrapped_fn),
-                *marker,
-            }
-        );
+            Common::BitCast<u64>(code.getCurr()),
+            Common::BitCast<u64>(wrapped_fn),
+            *marker,
+        });
 
         return;
     }
 
     Xbyak::Label abort, end;
 
-    const auto dest_ptr = EmitVAddrLookup(code, ctx.reg_alloc, config, abort, vaddr);
+    const auto dest_ptr = EmitVAddrLookup(code, ctx.reg_alloc, config, abort, vaddr, bitsize, true, page, tmp);
     switch (bitsize) {
     case 8:
         code.mov(code.byte[dest_ptr], value.cvt8());
@@ -1052,6 +1124,48 @@ void A32EmitX64::EmitA32ReadMemory64(A32EmitContext& ctx, IR::Inst* inst) {
     ReadMemory<64>(ctx, inst);
 }
 
+void A32EmitX64::EmitA32ReadMemory128(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
+
+    const auto wrapped_fn = read_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())];
+
+    if (!config.page_table) {
+        code.call(wrapped_fn);
+        ctx.reg_alloc.DefineValue(inst, value);
+        return;
+    }
+
+    if (const auto marker = ShouldFastmem(ctx, inst)) {
+        const auto location = code.getCurr();
+
+        code.movups(value, xword[r13 + vaddr]);
+
+        ctx.reg_alloc.DefineValue(inst, value);
+
+        AddFastmemPatchInfo(FastmemPatchInfo{
+            Common::BitCast<u64>(location),
+            Common::BitCast<u64>(code.getCurr()),
+            Common::BitCast<u64>(wrapped_fn),
+            *marker,
+        });
+
+        return;
+    }
+
+    Xbyak::Label abort, end;
+
+    const auto src_ptr = EmitVAddrLookup(code, ctx.reg_alloc, config, abort, vaddr, 128, false);
+    code.movups(value, xword[src_ptr]);
+    code.jmp(end);
+    code.L(abort);
+    code.call(wrapped_fn);
+    code.L(end);
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
 void A32EmitX64::EmitA32WriteMemory8(A32EmitContext& ctx, IR::Inst* inst) {
     WriteMemory<8>(ctx, inst);
 }
@@ -1068,53 +1182,189 @@ void A32EmitX64::EmitA32WriteMemory64(A32EmitContext& ctx, IR::Inst* inst) {
     WriteMemory<64>(ctx, inst);
 }
 
-template <typename T, void (A32::UserCallbacks::*fn)(A32::VAddr, T)>
-static void ExclusiveWrite(BlockOfCode& code, RegAlloc& reg_alloc, IR::Inst* inst, const A32::UserConfig& config, bool prepend_high_word) {
-    auto args = reg_alloc.GetArgumentInfo(inst);
-    if (prepend_high_word) {
-        reg_alloc.HostCall(nullptr, {}, args[0], args[1], args[2]);
-    } else {
-        reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+void A32EmitX64::EmitA32WriteMemory128(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
+
+    const auto wrapped_fn = write_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())];
+
+    if (!config.page_table) {
+        code.call(wrapped_fn);
+        return;
+    }
+
+    if (const auto marker = ShouldFastmem(ctx, inst)) {
+        const auto location = code.getCurr();
+
+        code.movups(xword[r13 + vaddr], value);
+
+        AddFastmemPatchInfo(FastmemPatchInfo{
+            Common::BitCast<u64>(location),
+            Common::BitCast<u64>(code.getCurr()),
+            Common::BitCast<u64>(wrapped_fn),
+            *marker,
+        });
+
+        return;
     }
-    const Xbyak::Reg32 passed = reg_alloc.ScratchGpr().cvt32();
-    const Xbyak::Reg32 tmp = code.ABI_RETURN.cvt32(); // Use one of the unused HostCall registers.
+
+    Xbyak::Label abort, end;
+
+    const auto dest_ptr = EmitVAddrLookup(code, ctx.reg_alloc, config, abort, vaddr, 128, true);
+    code.movups(xword[dest_ptr], value);
+    code.jmp(end);
+    code.L(abort);
+    code.call(wrapped_fn);
+    code.L(end);
+}
+
+void A32EmitX64::EmitA32ReadMemoryBlock(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 length = args[1].GetImmediateU8();
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    Devirtualize<&A32::UserCallbacks::MemoryReadBlock>(config.callbacks).EmitCall(code, [&](RegList param) {
+        code.lea(param[1], ptr[r15 + offsetof(A32JitState, memory_block)]);
+        code.mov(param[2], length);
+    });
+}
+
+void A32EmitX64::EmitA32WriteMemoryBlock(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 length = args[1].GetImmediateU8();
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    Devirtualize<&A32::UserCallbacks::MemoryWriteBlock>(config.callbacks).EmitCall(code, [&](RegList param) {
+        code.lea(param[1], ptr[r15 + offsetof(A32JitState, memory_block)]);
+        code.mov(param[2], length);
+    });
+}
+
+template<std::size_t bitsize, auto callback>
+void A32EmitX64::ExclusiveReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (!config.page_table) {
+        ctx.reg_alloc.HostCall(inst, {}, args[0]);
+        code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(1));
+        code.mov(dword[r15 + offsetof(A32JitState, exclusive_address)], code.ABI_PARAM2.cvt32());
+        Devirtualize<callback>(config.callbacks).EmitCall(code);
+        return;
+    }
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+
+    code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(1));
+    code.mov(dword[r15 + offsetof(A32JitState, exclusive_address)], vaddr.cvt32());
+    EmitReadMemoryAccess<bitsize>(ctx, inst, vaddr, value);
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A32EmitX64::EmitA32ExclusiveReadMemory8(A32EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory<8, &A32::UserCallbacks::MemoryRead8>(ctx, inst);
+}
+
+void A32EmitX64::EmitA32ExclusiveReadMemory16(A32EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory<16, &A32::UserCallbacks::MemoryRead16>(ctx, inst);
+}
+
+void A32EmitX64::EmitA32ExclusiveReadMemory32(A32EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory<32, &A32::UserCallbacks::MemoryRead32>(ctx, inst);
+}
+
+void A32EmitX64::EmitA32ExclusiveReadMemory64(A32EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory<64, &A32::UserCallbacks::MemoryRead64>(ctx, inst);
+}
+
+template<std::size_t bitsize, auto callback>
+void A32EmitX64::ExclusiveWriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
+    constexpr bool prepend_high_word = bitsize == 64;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (!config.page_table) {
+        if (prepend_high_word) {
+            ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1], args[2]);
+        } else {
+            ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+        }
+        const Xbyak::Reg32 passed = ctx.reg_alloc.ScratchGpr().cvt32();
+        const Xbyak::Reg32 tmp = code.ABI_RETURN.cvt32(); // Use one of the unused HostCall registers.
+
+        Xbyak::Label end;
+
+        code.mov(passed, u32(1));
+        code.cmp(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
+        code.je(end);
+        code.mov(tmp, code.ABI_PARAM2);
+        code.xor_(tmp, dword[r15 + offsetof(A32JitState, exclusive_address)]);
+        code.test(tmp, A32JitState::RESERVATION_GRANULE_MASK);
+        code.jne(end);
+        code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
+        if (prepend_high_word) {
+            code.mov(code.ABI_PARAM3.cvt32(), code.ABI_PARAM3.cvt32()); // zero extend to 64-bits
+            code.shl(code.ABI_PARAM4, 32);
+            code.or_(code.ABI_PARAM3, code.ABI_PARAM4);
+        }
+        Devirtualize<callback>(config.callbacks).EmitCall(code);
+        code.xor_(passed, passed);
+        code.L(end);
+
+        ctx.reg_alloc.DefineValue(inst, passed);
+        return;
+    }
+
+    // The exclusive monitor is local to this core, so once the reservation has been checked the
+    // store itself is an ordinary one and can go through the page table or fastmem.
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 value = prepend_high_word ? ctx.reg_alloc.UseScratchGpr(args[1]) : ctx.reg_alloc.UseGpr(args[1]);
+    if (prepend_high_word) {
+        const Xbyak::Reg64 value_hi = ctx.reg_alloc.UseScratchGpr(args[2]);
+        code.mov(value.cvt32(), value.cvt32()); // zero extend to 64-bits
+        code.shl(value_hi, 32);
+        code.or_(value, value_hi);
+    }
+    const Xbyak::Reg32 passed = ctx.reg_alloc.ScratchGpr().cvt32();
+    // The page table lookup runs only once the reservation has been checked, so its scratch
+    // registers must be allocated up front: anything the register allocator emits for them
+    // would otherwise be skipped whenever the store fails.
+    const Xbyak::Reg64 page = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
 
     Xbyak::Label end;
 
     code.mov(passed, u32(1));
     code.cmp(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
-    code.je(end);
-    code.mov(tmp, code.ABI_PARAM2);
-    code.xor_(tmp, dword[r15 + offsetof(A32JitState, exclusive_address)]);
-    code.test(tmp, A32JitState::RESERVATION_GRANULE_MASK);
-    code.jne(end);
+    code.je(end, code.T_NEAR);
+    code.mov(tmp.cvt32(), vaddr.cvt32());
+    code.xor_(tmp.cvt32(), dword[r15 + offsetof(A32JitState, exclusive_address)]);
+    code.test(tmp.cvt32(), A32JitState::RESERVATION_GRANULE_MASK);
+    code.jne(end, code.T_NEAR);
     code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
-    if (prepend_high_word) {
-        code.mov(code.ABI_PARAM3.cvt32(), code.ABI_PARAM3.cvt32()); // zero extend to 64-bits
-        code.shl(code.ABI_PARAM4, 32);
-        code.or_(code.ABI_PARAM3, code.ABI_PARAM4);
-    }
-    Devirtualize<fn>(config.callbacks).EmitCall(code);
+    EmitWriteMemoryAccess<bitsize>(ctx, inst, vaddr, value, page, tmp);
     code.xor_(passed, passed);
     code.L(end);
 
-    reg_alloc.DefineValue(inst, passed);
+    ctx.reg_alloc.DefineValue(inst, passed);
 }
 
 void A32EmitX64::EmitA32ExclusiveWriteMemory8(A32EmitContext& ctx, IR::Inst* inst) {
-    ExclusiveWrite<u8, &A32::UserCallbacks::MemoryWrite8>(code, ctx.reg_alloc, inst, config, false);
+    ExclusiveWriteMemory<8, &A32::UserCallbacks::MemoryWrite8>(ctx, inst);
 }
 
 void A32EmitX64::EmitA32ExclusiveWriteMemory16(A32EmitContext& ctx, IR::Inst* inst) {
-    ExclusiveWrite<u16, &A32::UserCallbacks::MemoryWrite16>(code, ctx.reg_alloc, inst, config, false);
+    ExclusiveWriteMemory<16, &A32::UserCallbacks::MemoryWrite16>(ctx, inst);
 }
 
 void A32EmitX64::EmitA32ExclusiveWriteMemory32(A32EmitContext& ctx, IR::Inst* inst) {
-    ExclusiveWrite<u32, &A32::UserCallbacks::MemoryWrite32>(code, ctx.reg_alloc, inst, config, false);
+    ExclusiveWriteMemory<32, &A32::UserCallbacks::MemoryWrite32>(ctx, inst);
 }
 
 void A32EmitX64::EmitA32ExclusiveWriteMemory64(A32EmitContext& ctx, IR::Inst* inst) {
-    ExclusiveWrite<u64, &A32::UserCallbacks::MemoryWrite64>(code, ctx.reg_alloc, inst, config, true);
+    ExclusiveWriteMemory<64, &A32::UserCallbacks::MemoryWrite64>(ctx, inst);
 }
 
 static void EmitCoprocessorException() {
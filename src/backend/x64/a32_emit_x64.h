@@ -9,7 +9,7 @@
 #include <optional>
 #include <set>
 #include <tuple>
-#include <unordered_map>
+#include <vector>
 
 #include <dynarmic/A32/a32.h>
 #include <dynarmic/A32/config.h>
@@ -87,11 +87,14 @@ protected:
     // Fastmem information
     using DoNotFastmemMarker = std::tuple<IR::LocationDescriptor, std::ptrdiff_t>;
     struct FastmemPatchInfo {
+        u64 rip;
         u64 resume_rip;
         u64 callback;
         DoNotFastmemMarker marker;
     };
-    std::unordered_map<u64, FastmemPatchInfo> fastmem_patch_info;
+    /// Sorted by rip, so that it can be binary searched from the fault handler.
+    std::vector<FastmemPatchInfo> fastmem_patch_info;
+    void AddFastmemPatchInfo(FastmemPatchInfo info);
     std::set<DoNotFastmemMarker> do_not_fastmem;
     std::optional<DoNotFastmemMarker> ShouldFastmem(A32EmitContext& ctx, IR::Inst* inst) const;
     FakeCall FastmemCallback(u64 rip);
@@ -101,6 +104,15 @@ protected:
     void ReadMemory(A32EmitContext& ctx, IR::Inst* inst);
     template<std::size_t bitsize>
     void WriteMemory(A32EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void EmitReadMemoryAccess(A32EmitContext& ctx, IR::Inst* inst, Xbyak::Reg64 vaddr, Xbyak::Reg64 value);
+    template<std::size_t bitsize>
+    void EmitWriteMemoryAccess(A32EmitContext& ctx, IR::Inst* inst, Xbyak::Reg64 vaddr, Xbyak::Reg64 value,
+                               std::optional<Xbyak::Reg64> page = {}, std::optional<Xbyak::Reg64> tmp = {});
+    template<std::size_t bitsize, auto callback>
+    void ExclusiveReadMemory(A32EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize, auto callback>
+    void ExclusiveWriteMemory(A32EmitContext& ctx, IR::Inst* inst);
 
     // Terminal instruction emitters
     void EmitSetUpperLocationDescriptor(IR::LocationDescriptor new_location, IR::LocationDescriptor old_location);
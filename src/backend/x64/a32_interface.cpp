@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
 #include <fmt/format.h>
@@ -26,6 +27,7 @@
 #include "frontend/A32/translate/translate.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/location_descriptor.h"
+#include "ir_opt/pass_manager.h"
 #include "ir_opt/passes.h"
 
 namespace Dynarmic::A32 {
@@ -51,11 +53,38 @@ static std::function<void(BlockOfCode&)> GenRCP(const A32::UserConfig& config) {
     };
 }
 
+static Optimization::PassManager GenPassManager(const A32::UserConfig& config) {
+    std::vector<OptimizationPass> pipeline;
+    if (config.enable_optimizations) {
+        pipeline = Optimization::GetPipeline(config.optimization_level, config.optimization_passes);
+    }
+
+    Optimization::PassManager pass_manager{std::move(pipeline), config.record_pass_statistics};
+    pass_manager.Register(OptimizationPass::GetSetElimination, &Optimization::A32GetSetElimination);
+    pass_manager.Register(OptimizationPass::ConstantMemoryReads, [cb = config.callbacks](IR::Block& block) {
+        Optimization::A32ConstantMemoryReads(block, cb);
+    });
+    pass_manager.Register(OptimizationPass::ConstantPropagation, &Optimization::ConstantPropagation);
+    pass_manager.Register(OptimizationPass::Peephole, &Optimization::PeepholePass);
+    pass_manager.Register(OptimizationPass::DeadCodeElimination, &Optimization::DeadCodeElimination);
+    pass_manager.Register(OptimizationPass::Simplification, &Optimization::SimplificationPass);
+    // Memory that is only reachable through the callbacks may be memory-mapped I/O, where repeated reads are observable
+    // and each access must reach the callbacks with the width the guest used.
+    if (config.page_table || config.fastmem_pointer) {
+        pass_manager.Register(OptimizationPass::RedundantLoadElimination, [forward_writes = !config.page_table_attribute_bits](IR::Block& block) {
+            Optimization::A32RedundantLoadElimination(block, forward_writes);
+        });
+        pass_manager.Register(OptimizationPass::MemoryCoalescing, &Optimization::A32MemoryCoalescingPass);
+    }
+    return pass_manager;
+}
+
 struct Jit::Impl {
     Impl(Jit* jit, A32::UserConfig config)
             : block_of_code(GenRunCodeCallbacks(config.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state}, GenRCP(config))
             , emitter(block_of_code, config, jit)
             , config(std::move(config))
+            , pass_manager(GenPassManager(this->config))
             , jit_interface(jit)
     {}
 
@@ -64,6 +93,7 @@ struct Jit::Impl {
     A32EmitX64 emitter;
 
     const A32::UserConfig config;
+    Optimization::PassManager pass_manager;
 
     // Requests made during execution to invalidate the cache are queued up here.
     size_t invalid_cache_generation = 0;
@@ -158,13 +188,12 @@ private:
             PerformCacheInvalidation();
         }
 
-        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, [this](u32 vaddr) { return config.callbacks->MemoryReadCode(vaddr); }, {config.define_unpredictable_behaviour, config.hook_hint_instructions});
-        if (config.enable_optimizations) {
-            Optimization::A32GetSetElimination(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
-            Optimization::A32ConstantMemoryReads(ir_block, config.callbacks);
-            Optimization::ConstantPropagation(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
+        const auto get_code = [this](u32 vaddr) { return config.callbacks->MemoryReadCode(vaddr); };
+        const auto get_code_page = [this](u32 vaddr) { return config.callbacks->MemoryReadCodePage(vaddr); };
+        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, get_code, {config.define_unpredictable_behaviour, config.hook_hint_instructions}, get_code_page);
+        pass_manager.Run(ir_block);
+        if (config.enable_memory_block_callbacks && !config.page_table) {
+            Optimization::A32MemoryBlockPass(ir_block);
         }
         Optimization::VerificationPass(ir_block);
         return emitter.Emit(ir_block);
@@ -314,4 +343,12 @@ std::string Jit::Disassemble(const IR::LocationDescriptor& descriptor) {
     return impl->Disassemble(descriptor);
 }
 
+std::vector<PassStatistics> Jit::GetPassStatistics() const {
+    return impl->pass_manager.GetStatistics();
+}
+
+void Jit::ResetPassStatistics() {
+    impl->pass_manager.ResetStatistics();
+}
+
 } // namespace Dynarmic::A32
@@ -66,6 +66,10 @@ struct A32JitState {
     std::array<u64, RSBSize> rsb_codeptrs;
     void ResetRSB();
 
+    // Memory block buffer (See: A32::UserConfig::enable_memory_block_callbacks)
+    static constexpr size_t MemoryBlockSize = 64;
+    alignas(16) std::array<u8, MemoryBlockSize> memory_block{};
+
     u32 fpsr_exc = 0;
     u32 fpsr_qc = 0; // Dummy value
     u32 fpsr_nzcv = 0;
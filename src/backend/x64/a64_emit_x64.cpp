@@ -58,6 +58,9 @@ A64EmitX64::A64EmitX64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_in
         : EmitX64(code), conf(conf), jit_interface{jit_interface} {
     GenMemory128Accessors();
     GenFastmemFallbacks();
+    if (conf.enable_software_tlb) {
+        GenTlbRefills();
+    }
     GenTerminalHandlers();
     code.PreludeComplete();
     ClearFastDispatchTable();
@@ -645,6 +648,10 @@ void A64EmitX64::EmitA64InstructionSynchronizationBarrier(A64EmitContext& ctx, I
     code.CallLambda([](A64::Jit* jit) { jit->ClearCache(); });
 }
 
+void A64EmitX64::EmitA64OrderedAccessBarrier(A64EmitContext&, IR::Inst*) {
+    // Loads already have acquire semantics and stores release semantics on x86-64.
+}
+
 void A64EmitX64::EmitA64GetCNTFRQ(A64EmitContext& ctx, IR::Inst* inst) {
     const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
     code.mov(result, conf.cntfrq_el0);
@@ -755,7 +762,67 @@ void EmitDetectMisaignedVAddr(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     code.SwitchToNearCode();
 }
 
-Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr, std::optional<Xbyak::Reg64> arg_scratch = {}) {
+// Number of page index bits indexed by a given level of a multi-level page table.
+// See A64::UserConfig::page_table_levels for a description of the layout.
+size_t PageTableLevelBits(const A64::UserConfig& conf, size_t level) {
+    const size_t valid_page_index_bits = conf.page_table_address_space_bits - page_bits;
+    const size_t lower_level_bits = valid_page_index_bits / conf.page_table_levels;
+    if (level == 0) {
+        return valid_page_index_bits - lower_level_bits * (conf.page_table_levels - 1);
+    }
+    return lower_level_bits;
+}
+
+// Checks the final level page_table entry in page, removing any attribute bits.
+// Writes to pages with attribute bits set are sent to abort.
+void EmitCheckPageTableEntry(BlockOfCode& code, A64EmitContext& ctx, Xbyak::Label& abort, Xbyak::Reg64 page, bool is_write) {
+    if (!ctx.conf.page_table_attribute_bits) {
+        code.test(page, page);
+        code.jz(abort, code.T_NEAR);
+        return;
+    }
+
+    if (is_write) {
+        code.test(page, static_cast<u32>(A64::UserConfig::PAGE_ATTRIBUTE_MASK));
+        code.jnz(abort, code.T_NEAR);
+    }
+    code.and_(page, ~static_cast<u32>(A64::UserConfig::PAGE_ATTRIBUTE_MASK));
+    code.jz(abort, code.T_NEAR);
+}
+
+// Walks a multi-level page table, leaving the host page pointer in page_table.
+void EmitMultiLevelPageTableWalk(BlockOfCode& code, A64EmitContext& ctx, Xbyak::Label& abort, Xbyak::Reg64 vaddr, Xbyak::Reg64 page_table, Xbyak::Reg64 tmp, bool is_write) {
+    const size_t unused_top_bits = 64 - ctx.conf.page_table_address_space_bits;
+
+    if (unused_top_bits != 0 && !ctx.conf.silently_mirror_page_table) {
+        code.mov(tmp, vaddr);
+        code.shr(tmp, int(ctx.conf.page_table_address_space_bits));
+        code.jnz(abort, code.T_NEAR);
+    }
+
+    size_t shift = ctx.conf.page_table_address_space_bits;
+    for (size_t level = 0; level < ctx.conf.page_table_levels; level++) {
+        const size_t level_bits = PageTableLevelBits(ctx.conf, level);
+        shift -= level_bits;
+
+        code.mov(tmp, vaddr);
+        code.shr(tmp, int(shift));
+        // The top level only needs masking if there are bits above it to discard.
+        if (level != 0 || (unused_top_bits != 0 && ctx.conf.silently_mirror_page_table)) {
+            ASSERT(level_bits < 32);
+            code.and_(tmp, u32((u64(1) << level_bits) - 1));
+        }
+        code.mov(page_table, qword[page_table + tmp * sizeof(void*)]);
+        if (level + 1 == ctx.conf.page_table_levels) {
+            EmitCheckPageTableEntry(code, ctx, abort, page_table, is_write);
+        } else {
+            code.test(page_table, page_table);
+            code.jz(abort, code.T_NEAR);
+        }
+    }
+}
+
+Xbyak::RegExp EmitPageTableLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, bool is_write, Xbyak::Label& abort, Xbyak::Reg64 vaddr, std::optional<Xbyak::Reg64> arg_scratch) {
     const size_t valid_page_index_bits = ctx.conf.page_table_address_space_bits - page_bits;
     const size_t unused_top_bits = 64 - ctx.conf.page_table_address_space_bits;
 
@@ -765,6 +832,16 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr, tmp);
 
     code.mov(page_table, reinterpret_cast<u64>(ctx.conf.page_table));
+    if (ctx.conf.page_table_levels > 1) {
+        EmitMultiLevelPageTableWalk(code, ctx, abort, vaddr, page_table, tmp, is_write);
+        if (ctx.conf.absolute_offset_page_table) {
+            return page_table + vaddr;
+        }
+        code.mov(tmp, vaddr);
+        code.and_(tmp, static_cast<u32>(page_size - 1));
+        return page_table + tmp;
+    }
+
     code.mov(tmp, vaddr);
     if (unused_top_bits == 0) {
         code.shr(tmp, int(page_bits));
@@ -783,8 +860,7 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bit
         code.jnz(abort, code.T_NEAR);
     }
     code.mov(page_table, qword[page_table + tmp * sizeof(void*)]);
-    code.test(page_table, page_table);
-    code.jz(abort, code.T_NEAR);
+    EmitCheckPageTableEntry(code, ctx, abort, page_table, is_write);
     if (ctx.conf.absolute_offset_page_table) {
         return page_table + vaddr;
     }
@@ -793,8 +869,136 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     return page_table + tmp;
 }
 
+// Final level page_table entry for vaddr, computed in the same way as EmitPageTableLookup.
+// This includes any attribute bits.
+u8* LookupPageTable(const A64::UserConfig& conf, u64 vaddr) {
+    const size_t unused_top_bits = 64 - conf.page_table_address_space_bits;
+    if (unused_top_bits != 0 && !conf.silently_mirror_page_table && (vaddr >> conf.page_table_address_space_bits) != 0) {
+        return nullptr;
+    }
+
+    void* const* table = conf.page_table;
+    size_t shift = conf.page_table_address_space_bits;
+    for (size_t level = 0; level < conf.page_table_levels; level++) {
+        const size_t level_bits = PageTableLevelBits(conf, level);
+        shift -= level_bits;
+
+        void* const entry = table[(vaddr >> shift) & ((u64(1) << level_bits) - 1)];
+        if (!entry) {
+            return nullptr;
+        }
+        if (level + 1 == conf.page_table_levels) {
+            return static_cast<u8*>(entry);
+        }
+        table = static_cast<void* const*>(entry);
+    }
+    UNREACHABLE();
+}
+
+void RefillTlb(const A64::UserConfig& conf, u64 vaddr, A64JitState& jit_state) {
+    static_assert(A64JitState::TlbPageBits == page_bits);
+
+    const u64 page = vaddr & ~u64(page_size - 1);
+
+    u8* host_page;
+    u64 attributes = 0;
+    if (conf.page_table) {
+        host_page = LookupPageTable(conf, page);
+        if (conf.page_table_attribute_bits) {
+            const u64 entry = reinterpret_cast<u64>(host_page);
+            attributes = entry & A64::UserConfig::PAGE_ATTRIBUTE_MASK;
+            host_page = reinterpret_cast<u8*>(entry & ~u64(A64::UserConfig::PAGE_ATTRIBUTE_MASK));
+        }
+        if (host_page && conf.absolute_offset_page_table) {
+            host_page += page;
+        }
+    } else {
+        host_page = conf.callbacks->TranslateAddress(page);
+    }
+
+    if (!host_page) {
+        return;
+    }
+
+    A64JitState::TlbEntry& entry = jit_state.tlb[(page >> page_bits) & A64JitState::TlbIndexMask];
+    entry.tag = attributes != 0 ? page | A64JitState::TlbTagWriteCallback : page;
+    entry.addend = reinterpret_cast<u64>(host_page) - page;
+}
+
+Xbyak::RegExp EmitSoftwareTlbLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, bool is_write, Xbyak::Label& abort, Xbyak::Reg64 vaddr, void (*refill)(), std::optional<Xbyak::Reg64> arg_scratch) {
+    static_assert(sizeof(A64JitState::TlbEntry) == 1 << 4);
+
+    const Xbyak::Reg64 addend = arg_scratch ? *arg_scratch : ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr, tmp);
+
+    const auto probe = [&](Xbyak::Label& on_miss) {
+        code.mov(tmp, vaddr);
+        code.shr(tmp, int(page_bits - 4));
+        code.and_(tmp, u32(A64JitState::TlbIndexMask << 4));
+        // The tag is compared against the page of the last byte accessed,
+        // so accesses that straddle a page boundary always miss.
+        code.lea(addend, ptr[vaddr + bitsize / 8 - 1]);
+        code.and_(addend, ~u32(page_size - 1));
+        if (is_write || !ctx.conf.page_table || !ctx.conf.page_table_attribute_bits) {
+            code.cmp(addend, qword[r15 + tmp + offsetof(A64JitState, tlb) + offsetof(A64JitState::TlbEntry, tag)]);
+            code.jne(on_miss, code.T_NEAR);
+        } else {
+            // Reads ignore TlbTagWriteCallback.
+            code.xor_(addend, qword[r15 + tmp + offsetof(A64JitState, tlb) + offsetof(A64JitState::TlbEntry, tag)]);
+            code.cmp(addend, u32(A64JitState::TlbTagWriteCallback));
+            code.ja(on_miss, code.T_NEAR);
+        }
+        code.mov(addend, qword[r15 + tmp + offsetof(A64JitState, tlb) + offsetof(A64JitState::TlbEntry, addend)]);
+    };
+
+    Xbyak::Label miss, hit;
+
+    probe(miss);
+    code.L(hit);
+
+    // NOTE: Misaligned accesses detected at a page boundary fall through into here, and always miss again below.
+    code.SwitchToFarCode();
+    code.L(miss);
+    code.call(refill);
+    probe(abort);
+    code.jmp(hit, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    return addend + vaddr;
+}
+
 } // anonymous namepsace
 
+void A64EmitX64::GenTlbRefills() {
+    for (int vaddr_idx = 0; vaddr_idx < 16; vaddr_idx++) {
+        if (vaddr_idx == 4 || vaddr_idx == 15) {
+            continue;
+        }
+
+        code.align();
+        tlb_refills[vaddr_idx] = code.getCurr<void(*)()>();
+        ABI_PushCallerSaveRegistersAndAdjustStack(code);
+        if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+            code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+        }
+        code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.mov(code.ABI_PARAM3, r15);
+        code.CallFunction(&RefillTlb);
+        ABI_PopCallerSaveRegistersAndAdjustStack(code);
+        code.ret();
+        PerfMapRegister(tlb_refills[vaddr_idx], code.getCurr(), "a64_tlb_refill");
+    }
+}
+
+Xbyak::RegExp A64EmitX64::EmitVAddrLookup(A64EmitContext& ctx, size_t bitsize, bool is_write, Xbyak::Label& abort, Xbyak::Reg64 vaddr, std::optional<Xbyak::Reg64> arg_scratch) {
+    if (conf.enable_software_tlb) {
+        return EmitSoftwareTlbLookup(code, ctx, bitsize, is_write, abort, vaddr, tlb_refills[vaddr.getIdx()], arg_scratch);
+    }
+    return EmitPageTableLookup(code, ctx, bitsize, is_write, abort, vaddr, arg_scratch);
+}
+
 void A64EmitX64::EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
     Xbyak::Label abort, end;
 
@@ -802,7 +1006,7 @@ void A64EmitX64::EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* in
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
 
-    const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, value);
+    const auto src_ptr = EmitVAddrLookup(ctx, bitsize, false, abort, vaddr, value);
     switch (bitsize) {
     case 8:
         code.movzx(value.cvt32(), code.byte[src_ptr]);
@@ -835,7 +1039,7 @@ void A64EmitX64::EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* i
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
 
-    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    const auto dest_ptr = EmitVAddrLookup(ctx, bitsize, true, abort, vaddr);
     switch (bitsize) {
     case 8:
         code.mov(code.byte[dest_ptr], value.cvt8());
@@ -860,7 +1064,7 @@ void A64EmitX64::EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* i
 }
 
 void A64EmitX64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryRead(ctx, inst, 8);
         return;
     }
@@ -871,7 +1075,7 @@ void A64EmitX64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryRead(ctx, inst, 16);
         return;
     }
@@ -882,7 +1086,7 @@ void A64EmitX64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryRead(ctx, inst, 32);
         return;
     }
@@ -893,7 +1097,7 @@ void A64EmitX64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryRead(ctx, inst, 64);
         return;
     }
@@ -904,14 +1108,14 @@ void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         Xbyak::Label abort, end;
 
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
         const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
         const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
 
-        const auto src_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
+        const auto src_ptr = EmitVAddrLookup(ctx, 128, false, abort, vaddr);
         code.movups(value, xword[src_ptr]);
         code.L(end);
 
@@ -1016,7 +1220,7 @@ void A64EmitX64::EmitA64ExclusiveReadMemory128(A64EmitContext& ctx, IR::Inst* in
 }
 
 void A64EmitX64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryWrite(ctx, inst, 8);
         return;
     }
@@ -1027,7 +1231,7 @@ void A64EmitX64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryWrite(ctx, inst, 16);
         return;
     }
@@ -1038,7 +1242,7 @@ void A64EmitX64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryWrite(ctx, inst, 32);
         return;
     }
@@ -1049,7 +1253,7 @@ void A64EmitX64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         EmitDirectPageTableMemoryWrite(ctx, inst, 64);
         return;
     }
@@ -1060,14 +1264,14 @@ void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
 }
 
 void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
+    if (conf.page_table || conf.enable_software_tlb) {
         Xbyak::Label abort, end;
 
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
         const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
         const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
 
-        const auto dest_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
+        const auto dest_ptr = EmitVAddrLookup(ctx, 128, true, abort, vaddr);
         code.movups(xword[dest_ptr], value);
         code.L(end);
 
@@ -1087,6 +1291,28 @@ void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
     code.CallFunction(memory_write_128);
 }
 
+void A64EmitX64::EmitA64ReadMemoryBlock(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 length = args[1].GetImmediateU8();
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    Devirtualize<&A64::UserCallbacks::MemoryReadBlock>(conf.callbacks).EmitCall(code, [&](RegList param) {
+        code.lea(param[1], ptr[r15 + offsetof(A64JitState, memory_block)]);
+        code.mov(param[2], length);
+    });
+}
+
+void A64EmitX64::EmitA64WriteMemoryBlock(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 length = args[1].GetImmediateU8();
+    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    Devirtualize<&A64::UserCallbacks::MemoryWriteBlock>(conf.callbacks).EmitCall(code, [&](RegList param) {
+        code.lea(param[1], ptr[r15 + offsetof(A64JitState, memory_block)]);
+        code.mov(param[2], length);
+    });
+}
+
 void A64EmitX64::EmitExclusiveWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
     ASSERT(conf.global_monitor != nullptr);
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
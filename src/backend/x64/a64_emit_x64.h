@@ -5,7 +5,9 @@
 
 #pragma once
 
+#include <array>
 #include <map>
+#include <optional>
 #include <tuple>
 
 #include <dynarmic/A64/a64.h>
@@ -74,11 +76,15 @@ protected:
     std::map<std::tuple<size_t, int, int>, void(*)()> write_fallbacks;
     void GenFastmemFallbacks();
 
+    std::array<void(*)(), 16> tlb_refills{};
+    void GenTlbRefills();
+
     const void* terminal_handler_pop_rsb_hint;
     const void* terminal_handler_fast_dispatch_hint = nullptr;
     FastDispatchEntry& (*fast_dispatch_table_lookup)(u64) = nullptr;
     void GenTerminalHandlers();
 
+    Xbyak::RegExp EmitVAddrLookup(A64EmitContext& ctx, size_t bitsize, bool is_write, Xbyak::Label& abort, Xbyak::Reg64 vaddr, std::optional<Xbyak::Reg64> arg_scratch = {});
     void EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
     void EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
     void EmitExclusiveWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
@@ -5,6 +5,7 @@
 
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
 #include <dynarmic/A64/a64.h>
@@ -19,6 +20,7 @@
 #include "common/scope_exit.h"
 #include "frontend/A64/translate/translate.h"
 #include "frontend/ir/basic_block.h"
+#include "ir_opt/pass_manager.h"
 #include "ir_opt/passes.h"
 
 namespace Dynarmic::A64 {
@@ -37,14 +39,47 @@ static std::function<void(BlockOfCode&)> GenRCP(const A64::UserConfig&) {
     return [](BlockOfCode&){};
 }
 
+static Optimization::PassManager GenPassManager(const A64::UserConfig& conf) {
+    std::vector<OptimizationPass> pipeline;
+    if (conf.enable_optimizations) {
+        pipeline = Optimization::GetPipeline(conf.optimization_level, conf.optimization_passes);
+    }
+
+    Optimization::PassManager pass_manager{std::move(pipeline), conf.record_pass_statistics};
+    pass_manager.Register(OptimizationPass::GetSetElimination, &Optimization::A64GetSetElimination);
+    pass_manager.Register(OptimizationPass::ConstantMemoryReads, [cb = conf.callbacks](IR::Block& block) {
+        Optimization::A64ConstantMemoryReads(block, cb);
+    });
+    pass_manager.Register(OptimizationPass::ConstantPropagation, &Optimization::ConstantPropagation);
+    pass_manager.Register(OptimizationPass::Peephole, &Optimization::PeepholePass);
+    pass_manager.Register(OptimizationPass::DeadCodeElimination, &Optimization::DeadCodeElimination);
+    pass_manager.Register(OptimizationPass::Simplification, &Optimization::SimplificationPass);
+    // Memory that is only reachable through the callbacks may be memory-mapped I/O, where repeated reads are observable
+    // and each access must reach the callbacks with the width the guest used.
+    if (conf.page_table || conf.enable_software_tlb) {
+        pass_manager.Register(OptimizationPass::RedundantLoadElimination, [forward_writes = !conf.page_table_attribute_bits](IR::Block& block) {
+            Optimization::A64RedundantLoadElimination(block, forward_writes);
+        });
+        pass_manager.Register(OptimizationPass::MemoryCoalescing, [conf](IR::Block& block) {
+            Optimization::A64MemoryCoalescingPass(block, conf);
+        });
+    }
+    pass_manager.Register(OptimizationPass::MergeInterpretBlocks, [cb = conf.callbacks](IR::Block& block) {
+        Optimization::A64MergeInterpretBlocksPass(block, cb);
+    });
+    return pass_manager;
+}
+
 struct Jit::Impl final {
 public:
     Impl(Jit* jit, UserConfig conf)
         : conf(conf)
         , block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state}, GenRCP(conf))
         , emitter(block_of_code, conf, jit)
+        , pass_manager(GenPassManager(conf))
     {
         ASSERT(conf.page_table_address_space_bits >= 12 && conf.page_table_address_space_bits <= 64);
+        ASSERT(conf.page_table_levels >= 1 && conf.page_table_levels <= 4);
     }
 
     ~Impl() = default;
@@ -104,6 +139,14 @@ public:
         RequestCacheInvalidation();
     }
 
+    void InvalidateTlb() {
+        jit_state.InvalidateTlb();
+    }
+
+    void InvalidateTlbRange(u64 start_address, size_t length) {
+        jit_state.InvalidateTlbRange(start_address, length);
+    }
+
     void Reset() {
         ASSERT(!is_executing);
         jit_state = {};
@@ -211,6 +254,14 @@ public:
         return Common::DisassembleX64(block_of_code.GetCodeBegin(), block_of_code.getCurr());
     }
 
+    std::vector<PassStatistics> GetPassStatistics() const {
+        return pass_manager.GetStatistics();
+    }
+
+    void ResetPassStatistics() {
+        pass_manager.ResetStatistics();
+    }
+
 private:
     static CodePtr GetCurrentBlockThunk(void* thisptr) {
         Jit::Impl* this_ = static_cast<Jit::Impl*>(thisptr);
@@ -242,15 +293,13 @@ private:
 
         // JIT Compile
         const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
+        const auto get_code_page = [this](u64 vaddr) { return conf.callbacks->MemoryReadCodePage(vaddr); };
         IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code,
-                                                {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+                                                {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct}, get_code_page);
         Optimization::A64CallbackConfigPass(ir_block, conf);
-        if (conf.enable_optimizations) {
-            Optimization::A64GetSetElimination(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
-            Optimization::ConstantPropagation(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
-            Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
+        pass_manager.Run(ir_block);
+        if (conf.enable_memory_block_callbacks && !conf.page_table && !conf.enable_software_tlb) {
+            Optimization::A64MemoryBlockPass(ir_block);
         }
         // printf("%s\n", IR::DumpBlock(ir_block).c_str());
         Optimization::VerificationPass(ir_block);
@@ -288,6 +337,7 @@ private:
     A64JitState jit_state;
     BlockOfCode block_of_code;
     A64EmitX64 emitter;
+    Optimization::PassManager pass_manager;
 
     bool invalidate_entire_cache = false;
     boost::icl::interval_set<u64> invalid_cache_ranges;
@@ -314,6 +364,14 @@ void Jit::InvalidateCacheRange(u64 start_address, size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
 
+void Jit::InvalidateTlb() {
+    impl->InvalidateTlb();
+}
+
+void Jit::InvalidateTlbRange(u64 start_address, size_t length) {
+    impl->InvalidateTlbRange(start_address, length);
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
@@ -414,4 +472,12 @@ std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
 
+std::vector<PassStatistics> Jit::GetPassStatistics() const {
+    return impl->GetPassStatistics();
+}
+
+void Jit::ResetPassStatistics() {
+    impl->ResetPassStatistics();
+}
+
 } // namespace Dynarmic::A64
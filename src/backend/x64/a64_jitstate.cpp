@@ -107,4 +107,30 @@ void A64JitState::SetFpsr(u32 value) {
     fpsr_exc = value & 0x9F;
 }
 
+void A64JitState::InvalidateTlb() {
+    for (TlbEntry& entry : tlb) {
+        entry.tag = TlbInvalidTag;
+        entry.addend = 0;
+    }
+}
+
+void A64JitState::InvalidateTlbRange(u64 start_address, size_t length) {
+    if (length == 0) {
+        return;
+    }
+
+    const u64 start_page = start_address >> TlbPageBits;
+    const u64 end_page = (start_address + length - 1) >> TlbPageBits;
+    for (TlbEntry& entry : tlb) {
+        if (entry.tag == TlbInvalidTag) {
+            continue;
+        }
+        const u64 page = entry.tag >> TlbPageBits;
+        if (page >= start_page && page <= end_page) {
+            entry.tag = TlbInvalidTag;
+            entry.addend = 0;
+        }
+    }
+}
+
 } // namespace Dynarmic::Backend::X64
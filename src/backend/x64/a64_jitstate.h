@@ -25,7 +25,7 @@ class BlockOfCode;
 struct A64JitState {
     using ProgramCounterType = u64;
 
-    A64JitState() { ResetRSB(); }
+    A64JitState() { ResetRSB(); InvalidateTlb(); }
 
     std::array<u64, 31> reg{};
     u64 sp = 0;
@@ -71,6 +71,10 @@ struct A64JitState {
         rsb_codeptrs.fill(0);
     }
 
+    // Memory block buffer (See: A64::UserConfig::enable_memory_block_callbacks)
+    static constexpr size_t MemoryBlockSize = 64;
+    alignas(16) std::array<u8, MemoryBlockSize> memory_block{};
+
     u32 fpsr_exc = 0;
     u32 fpsr_qc = 0;
     u32 fpcr = 0;
@@ -79,6 +83,24 @@ struct A64JitState {
     void SetFpcr(u32 value);
     void SetFpsr(u32 value);
 
+    // Software TLB (See: A64::UserConfig::enable_software_tlb)
+    // Each entry maps the guest page in tag to host memory at (vaddr + addend).
+    // Tags are page-aligned, so an invalid entry is marked by a tag with its low bits set.
+    // Entries for pages whose writes go through the memory callbacks have TlbTagWriteCallback set in their tag.
+    static constexpr size_t TlbPageBits = 12;
+    static constexpr size_t TlbSize = 256; // MUST be a power of 2.
+    static constexpr size_t TlbIndexMask = TlbSize - 1;
+    static constexpr u64 TlbInvalidTag = 0xFFFFFFFFFFFFFFFFull;
+    static constexpr u64 TlbTagWriteCallback = 1;
+    struct TlbEntry {
+        u64 tag;
+        u64 addend;
+    };
+    static_assert(sizeof(TlbEntry) == 16);
+    std::array<TlbEntry, TlbSize> tlb;
+    void InvalidateTlb();
+    void InvalidateTlbRange(u64 start_address, size_t length);
+
     u64 GetUniqueHash() const noexcept {
         const u64 fpcr_u64 = static_cast<u64>(fpcr & A64::LocationDescriptor::fpcr_mask) << A64::LocationDescriptor::fpcr_shift;
         const u64 pc_u64 = pc & A64::LocationDescriptor::pc_mask;
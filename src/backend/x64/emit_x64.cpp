@@ -168,6 +168,49 @@ void EmitX64::EmitNZCVFromPackedFlags(EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
+static Xbyak::Address MemoryBlockLocation(BlockOfCode& code, const Xbyak::AddressFrame& frame, u8 offset) {
+    return frame[code.r15 + code.GetJitStateInfo().offsetof_memory_block + offset];
+}
+
+void EmitX64::EmitGetMemoryBlock32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
+    code.mov(result, MemoryBlockLocation(code, code.dword, args[0].GetImmediateU8()));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitGetMemoryBlock64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+    code.mov(result, MemoryBlockLocation(code, code.qword, args[0].GetImmediateU8()));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitGetMemoryBlock128(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    code.movups(result, MemoryBlockLocation(code, code.xword, args[0].GetImmediateU8()));
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitSetMemoryBlock32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg32 value = ctx.reg_alloc.UseGpr(args[1]).cvt32();
+    code.mov(MemoryBlockLocation(code, code.dword, args[0].GetImmediateU8()), value);
+}
+
+void EmitX64::EmitSetMemoryBlock64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
+    code.mov(MemoryBlockLocation(code, code.qword, args[0].GetImmediateU8()), value);
+}
+
+void EmitX64::EmitSetMemoryBlock128(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
+    code.movups(MemoryBlockLocation(code, code.xword, args[0].GetImmediateU8()), value);
+}
+
 void EmitX64::EmitAddCycles(size_t cycles) {
     ASSERT(cycles < std::numeric_limits<u32>::max());
     code.sub(qword[r15 + code.GetJitStateInfo().offsetof_cycles_remaining], static_cast<u32>(cycles));
@@ -32,6 +32,14 @@ void EmitX64::EmitPack2x32To1x64(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitPack2x64To1x128(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (args[0].IsImmediate() && args[1].IsImmediate()) {
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        code.movaps(result, code.MConst(xword, args[0].GetImmediateU64(), args[1].GetImmediateU64()));
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     const Xbyak::Reg64 lo = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 hi = ctx.reg_alloc.UseGpr(args[1]);
     const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
@@ -970,6 +978,41 @@ void EmitX64::EmitAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitAdd(code, ctx, inst, 64);
 }
 
+static void EmitAddShiftedLeft(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[2].IsImmediate());
+
+    const u8 shift = args[2].GetImmediateU8();
+
+    if (shift <= 3) {
+        const Xbyak::Reg64 lhs = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg64 rhs = ctx.reg_alloc.UseGpr(args[1]);
+        const Xbyak::Reg result = ctx.reg_alloc.ScratchGpr().changeBit(bitsize);
+
+        code.lea(result, code.ptr[lhs + rhs * (1 << shift)]);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Reg result = ctx.reg_alloc.UseScratchGpr(args[1]).changeBit(bitsize);
+    OpArg lhs = ctx.reg_alloc.UseOpArg(args[0]);
+    lhs.setBit(bitsize);
+
+    code.shl(result, shift);
+    code.add(result, *lhs);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitAddShiftedLeft32(EmitContext& ctx, IR::Inst* inst) {
+    EmitAddShiftedLeft(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitAddShiftedLeft64(EmitContext& ctx, IR::Inst* inst) {
+    EmitAddShiftedLeft(code, ctx, inst, 64);
+}
+
 static void EmitSub(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
     const auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
     const auto overflow_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
@@ -1217,6 +1260,67 @@ void EmitX64::EmitAnd64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitX64::EmitAndNot32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (args[1].IsImmediate()) {
+        const Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
+        code.and_(result, u32(~args[1].GetImmediateU32()));
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI1)) {
+        const Xbyak::Reg32 lhs = ctx.reg_alloc.UseGpr(args[0]).cvt32();
+        const Xbyak::Reg32 rhs = ctx.reg_alloc.UseGpr(args[1]).cvt32();
+        const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
+        code.andn(result, rhs, lhs);
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(args[1]).cvt32();
+    OpArg lhs = ctx.reg_alloc.UseOpArg(args[0]);
+    lhs.setBit(32);
+
+    code.not_(result);
+    code.and_(result, *lhs);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitAndNot64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (args[1].IsImmediate()) {
+        const u64 mask = ~args[1].GetImmediateU64();
+        if (mask == static_cast<u64>(static_cast<s64>(static_cast<s32>(mask)))) {
+            const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(args[0]);
+            code.and_(result, static_cast<u32>(mask));
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI1)) {
+        const Xbyak::Reg64 lhs = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg64 rhs = ctx.reg_alloc.UseGpr(args[1]);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+        code.andn(result, rhs, lhs);
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(args[1]);
+    OpArg lhs = ctx.reg_alloc.UseOpArg(args[0]);
+    lhs.setBit(64);
+
+    code.not_(result);
+    code.and_(result, *lhs);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitEor32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
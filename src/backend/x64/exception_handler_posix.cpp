@@ -5,10 +5,13 @@
 
 #include "backend/x64/exception_handler.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include <signal.h>
@@ -22,6 +25,7 @@
 #include "common/assert.h"
 #include "common/cast_util.h"
 #include "common/common_types.h"
+#include "common/scope_exit.h"
 
 namespace Dynarmic::Backend::X64 {
 
@@ -32,6 +36,9 @@ struct CodeBlockInfo {
     std::function<FakeCall(u64)> cb;
 };
 
+/// Registered code blocks, sorted by code_begin. A published table is never modified.
+using CodeBlockTable = std::vector<CodeBlockInfo>;
+
 class SigHandler {
 public:
     SigHandler();
@@ -40,12 +47,22 @@ public:
     void RemoveCodeBlock(u64 rip);
 
 private:
-    auto FindCodeBlockInfo(u64 rip) {
-        return std::find_if(code_block_infos.begin(), code_block_infos.end(), [&](const auto& x) { return x.code_begin <= rip && x.code_end > rip; });
+    static auto FindCodeBlockInfo(const CodeBlockTable& table, u64 rip) {
+        auto iter = std::upper_bound(table.begin(), table.end(), rip, [](u64 rip, const auto& x) { return rip < x.code_begin; });
+        if (iter == table.begin() || std::prev(iter)->code_end <= rip) {
+            return table.end();
+        }
+        return std::prev(iter);
     }
 
-    std::vector<CodeBlockInfo> code_block_infos;
-    std::mutex code_block_infos_mutex;
+    void PublishCodeBlockTable(std::unique_ptr<CodeBlockTable> new_table);
+
+    // The signal handler reads the current table without taking any locks. Writers, which are
+    // serialised by code_block_table_mutex, publish a modified copy of the table and free the
+    // previous one once no signal handler can still be reading it.
+    std::atomic<const CodeBlockTable*> code_block_table{new CodeBlockTable{}};
+    std::atomic<size_t> active_handlers{0};
+    std::mutex code_block_table_mutex;
 
     struct sigaction old_sa_segv;
     struct sigaction old_sa_bus;
@@ -56,7 +73,7 @@ private:
 SigHandler sig_handler;
 
 SigHandler::SigHandler() {
-    constexpr size_t signal_stack_size = std::max(SIGSTKSZ, 2 * 1024 * 1024);
+    const size_t signal_stack_size = std::max<size_t>(SIGSTKSZ, 2 * 1024 * 1024);
 
     stack_t signal_stack;
     signal_stack.ss_sp = std::malloc(signal_stack_size);
@@ -76,21 +93,35 @@ SigHandler::SigHandler() {
 #endif
 }
 
+void SigHandler::PublishCodeBlockTable(std::unique_ptr<CodeBlockTable> new_table) {
+    const std::unique_ptr<const CodeBlockTable> old_table{code_block_table.exchange(new_table.release())};
+
+    // A signal handler that started before the exchange may still be using the old table.
+    while (active_handlers.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
 void SigHandler::AddCodeBlock(CodeBlockInfo cbi) {
-    std::lock_guard<std::mutex> guard(code_block_infos_mutex);
-    if (auto iter = FindCodeBlockInfo(cbi.code_begin); iter != code_block_infos.end()) {
-        code_block_infos.erase(iter);
+    std::lock_guard<std::mutex> guard(code_block_table_mutex);
+    auto new_table = std::make_unique<CodeBlockTable>(*code_block_table.load());
+    if (auto iter = FindCodeBlockInfo(*new_table, cbi.code_begin); iter != new_table->end()) {
+        new_table->erase(iter);
     }
-    code_block_infos.push_back(cbi);
+    const auto insertion_point = std::upper_bound(new_table->begin(), new_table->end(), cbi.code_begin, [](u64 code_begin, const auto& x) { return code_begin < x.code_begin; });
+    new_table->insert(insertion_point, std::move(cbi));
+    PublishCodeBlockTable(std::move(new_table));
 }
 
 void SigHandler::RemoveCodeBlock(u64 rip) {
-    std::lock_guard<std::mutex> guard(code_block_infos_mutex);
-    const auto iter = FindCodeBlockInfo(rip);
-    if (iter == code_block_infos.end()) {
+    std::lock_guard<std::mutex> guard(code_block_table_mutex);
+    auto new_table = std::make_unique<CodeBlockTable>(*code_block_table.load());
+    const auto iter = FindCodeBlockInfo(*new_table, rip);
+    if (iter == new_table->end()) {
         return;
     }
-    code_block_infos.erase(iter);
+    new_table->erase(iter);
+    PublishCodeBlockTable(std::move(new_table));
 }
 
 void SigHandler::SigAction(int sig, siginfo_t* info, void* raw_context) {
@@ -110,10 +141,12 @@ void SigHandler::SigAction(int sig, siginfo_t* info, void* raw_context) {
 #endif
 
     {
-        std::lock_guard<std::mutex> guard(sig_handler.code_block_infos_mutex);
+        sig_handler.active_handlers++;
+        SCOPE_EXIT { sig_handler.active_handlers--; };
 
-        const auto iter = sig_handler.FindCodeBlockInfo(CTX_RIP);
-        if (iter != sig_handler.code_block_infos.end()) {
+        const CodeBlockTable& table = *sig_handler.code_block_table.load();
+        const auto iter = FindCodeBlockInfo(table, CTX_RIP);
+        if (iter != table.end()) {
             FakeCall fc = iter->cb(CTX_RIP);
 
             CTX_RSP -= sizeof(u64);
@@ -23,6 +23,7 @@ struct JitStateInfo {
         , offsetof_cpsr_nzcv(offsetof(JitStateType, cpsr_nzcv))
         , offsetof_fpsr_exc(offsetof(JitStateType, fpsr_exc))
         , offsetof_fpsr_qc(offsetof(JitStateType, fpsr_qc))
+        , offsetof_memory_block(offsetof(JitStateType, memory_block))
     {}
 
     const size_t offsetof_cycles_remaining;
@@ -36,6 +37,7 @@ struct JitStateInfo {
     const size_t offsetof_cpsr_nzcv;
     const size_t offsetof_fpsr_exc;
     const size_t offsetof_fpsr_qc;
+    const size_t offsetof_memory_block;
 };
 
 } // namespace Dynarmic::Backend::X64
@@ -10,12 +10,11 @@
 namespace Dynarmic::Common {
 
 Pool::Pool(size_t object_size, size_t initial_pool_size) : object_size(object_size), slab_size(initial_pool_size) {
-    AllocateNewSlab();
+    slabs.emplace_back(static_cast<char*>(std::malloc(object_size * slab_size)));
+    Reset();
 }
 
 Pool::~Pool() {
-    std::free(current_slab);
-
     for (char* slab : slabs) {
         std::free(slab);
     }
@@ -23,8 +22,7 @@ Pool::~Pool() {
 
 void* Pool::Alloc() {
     if (remaining == 0) {
-        slabs.emplace_back(current_slab);
-        AllocateNewSlab();
+        NextSlab();
     }
 
     void* ret = static_cast<void*>(current_ptr);
@@ -34,9 +32,18 @@ void* Pool::Alloc() {
     return ret;
 }
 
-void Pool::AllocateNewSlab() {
-    current_slab = static_cast<char*>(std::malloc(object_size * slab_size));
-    current_ptr = current_slab;
+void Pool::Reset() {
+    current_slab_index = 0;
+    current_ptr = slabs[0];
+    remaining = slab_size;
+}
+
+void Pool::NextSlab() {
+    current_slab_index++;
+    if (current_slab_index == slabs.size()) {
+        slabs.emplace_back(static_cast<char*>(std::malloc(object_size * slab_size)));
+    }
+    current_ptr = slabs[current_slab_index];
     remaining = slab_size;
 }
 
@@ -28,15 +28,18 @@ public:
     /// Returns a pointer to an `object_size`-bytes block of memory.
     void* Alloc();
 
+    /// Invalidates all memory previously returned by Alloc, making it available for reuse.
+    /// Slabs are retained, so a reset pool can be refilled without further allocations.
+    void Reset();
+
 private:
-    // Allocates a completely new memory slab.
-    // Used when an entirely new slab is needed
-    // due the current one running out of usable space.
-    void AllocateNewSlab();
+    // Moves on to the next memory slab, allocating a completely new
+    // one if all existing slabs have run out of usable space.
+    void NextSlab();
 
     size_t object_size;
     size_t slab_size;
-    char* current_slab;
+    size_t current_slab_index;
     char* current_ptr;
     size_t remaining;
     std::vector<char*> slabs;
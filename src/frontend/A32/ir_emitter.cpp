@@ -98,7 +98,7 @@ void IREmitter::SetCpsr(const IR::U32& value) {
     Inst(Opcode::A32SetCpsr, value);
 }
 
-void IREmitter::SetCpsrNZCV(const IR::U32& value) {
+void IREmitter::SetCpsrNZCVRaw(const IR::U32& value) {
     Inst(Opcode::A32SetCpsrNZCVRaw, value);
 }
 
@@ -162,6 +162,10 @@ void IREmitter::InstructionSynchronizationBarrier() {
     Inst(Opcode::A32InstructionSynchronizationBarrier);
 }
 
+void IREmitter::OrderedAccessBarrier() {
+    Inst(Opcode::A32OrderedAccessBarrier);
+}
+
 IR::U32 IREmitter::GetFpscr() {
     return Inst<IR::U32>(Opcode::A32GetFpscr);
 }
@@ -182,11 +186,6 @@ void IREmitter::ClearExclusive() {
     Inst(Opcode::A32ClearExclusive);
 }
 
-void IREmitter::SetExclusive(const IR::U32& vaddr, size_t byte_size) {
-    ASSERT(byte_size == 1 || byte_size == 2 || byte_size == 4 || byte_size == 8 || byte_size == 16);
-    Inst(Opcode::A32SetExclusive, vaddr, Imm8(u8(byte_size)));
-}
-
 IR::UAny IREmitter::ReadMemory(size_t bitsize, const IR::U32& vaddr) {
     switch (bitsize) {
     case 8:
@@ -265,6 +264,30 @@ void IREmitter::WriteMemory64(const IR::U32& vaddr, const IR::U64& value) {
     }
 }
 
+IR::U8 IREmitter::ExclusiveReadMemory8(const IR::U32& vaddr) {
+    return Inst<IR::U8>(Opcode::A32ExclusiveReadMemory8, vaddr);
+}
+
+IR::U16 IREmitter::ExclusiveReadMemory16(const IR::U32& vaddr) {
+    const auto value = Inst<IR::U16>(Opcode::A32ExclusiveReadMemory16, vaddr);
+    return current_location.EFlag() ? ByteReverseHalf(value) : value;
+}
+
+IR::U32 IREmitter::ExclusiveReadMemory32(const IR::U32& vaddr) {
+    const auto value = Inst<IR::U32>(Opcode::A32ExclusiveReadMemory32, vaddr);
+    return current_location.EFlag() ? ByteReverseWord(value) : value;
+}
+
+std::pair<IR::U32, IR::U32> IREmitter::ExclusiveReadMemory64(const IR::U32& vaddr) {
+    const auto value = Inst<IR::U64>(Opcode::A32ExclusiveReadMemory64, vaddr);
+    const auto lo = LeastSignificantWord(value);
+    const auto hi = MostSignificantWord(value).result;
+    if (current_location.EFlag()) {
+        return std::make_pair(ByteReverseWord(lo), ByteReverseWord(hi));
+    }
+    return std::make_pair(lo, hi);
+}
+
 IR::U32 IREmitter::ExclusiveWriteMemory8(const IR::U32& vaddr, const IR::U8& value) {
     return Inst<IR::U32>(Opcode::A32ExclusiveWriteMemory8, vaddr, value);
 }
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "common/common_types.h"
 #include "frontend/A32/location_descriptor.h"
 #include "frontend/ir/ir_emitter.h"
@@ -46,7 +48,7 @@ public:
 
     IR::U32 GetCpsr();
     void SetCpsr(const IR::U32& value);
-    void SetCpsrNZCV(const IR::U32& value);
+    void SetCpsrNZCVRaw(const IR::U32& value);
     void SetCpsrNZCV(const IR::NZCV& value);
     void SetCpsrNZCVQ(const IR::U32& value);
     void SetCheckBit(const IR::U1& value);
@@ -63,6 +65,7 @@ public:
     void DataSynchronizationBarrier();
     void DataMemoryBarrier();
     void InstructionSynchronizationBarrier();
+    void OrderedAccessBarrier();
 
     IR::U32 GetFpscr();
     void SetFpscr(const IR::U32& new_fpscr);
@@ -70,7 +73,6 @@ public:
     void SetFpscrNZCV(const IR::NZCV& new_fpscr_nzcv);
 
     void ClearExclusive();
-    void SetExclusive(const IR::U32& vaddr, size_t byte_size);
     IR::UAny ReadMemory(size_t bitsize, const IR::U32& vaddr);
     IR::U8 ReadMemory8(const IR::U32& vaddr);
     IR::U16 ReadMemory16(const IR::U32& vaddr);
@@ -81,6 +83,10 @@ public:
     void WriteMemory16(const IR::U32& vaddr, const IR::U16& value);
     void WriteMemory32(const IR::U32& vaddr, const IR::U32& value);
     void WriteMemory64(const IR::U32& vaddr, const IR::U64& value);
+    IR::U8 ExclusiveReadMemory8(const IR::U32& vaddr);
+    IR::U16 ExclusiveReadMemory16(const IR::U32& vaddr);
+    IR::U32 ExclusiveReadMemory32(const IR::U32& vaddr);
+    std::pair<IR::U32, IR::U32> ExclusiveReadMemory64(const IR::U32& vaddr);
     IR::U32 ExclusiveWriteMemory8(const IR::U32& vaddr, const IR::U8& value);
     IR::U32 ExclusiveWriteMemory16(const IR::U32& vaddr, const IR::U16& value);
     IR::U32 ExclusiveWriteMemory32(const IR::U32& vaddr, const IR::U32& value);
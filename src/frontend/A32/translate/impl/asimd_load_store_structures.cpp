@@ -96,15 +96,23 @@ bool ArmTranslatorVisitor::v8_VST_multiple(bool D, Reg n, size_t Vd, Imm<4> type
     const bool register_index = m != Reg::R15 && m != Reg::R13;
 
     IR::U32 address = ir.GetRegister(n);
-    for (size_t r = 0; r < regs; r++) {
-        for (size_t e = 0; e < elements; e++) {
-            for (size_t i = 0; i < nelem; i++) {
-                const ExtReg ext_reg = d + i * inc + r;
-                const IR::U64 shifted_element = ir.LogicalShiftRight(ir.GetExtendedRegister(ext_reg), ir.Imm8(static_cast<u8>(e * ebytes * 8)));
-                const IR::UAny element = ir.LeastSignificant(8 * ebytes, shifted_element);
-                ir.WriteMemory(8 * ebytes, address, element);
-
-                address = ir.Add(address, ir.Imm32(static_cast<u32>(ebytes)));
+    if (nelem == 1 && !ir.current_location.EFlag()) {
+        // VST1 stores whole registers back to back.
+        for (size_t r = 0; r < regs; r++) {
+            ir.WriteMemory64(address, ir.GetExtendedRegister(d + r));
+            address = ir.Add(address, ir.Imm32(8));
+        }
+    } else {
+        for (size_t r = 0; r < regs; r++) {
+            for (size_t e = 0; e < elements; e++) {
+                for (size_t i = 0; i < nelem; i++) {
+                    const ExtReg ext_reg = d + i * inc + r;
+                    const IR::U64 shifted_element = ir.LogicalShiftRight(ir.GetExtendedRegister(ext_reg), ir.Imm8(static_cast<u8>(e * ebytes * 8)));
+                    const IR::UAny element = ir.LeastSignificant(8 * ebytes, shifted_element);
+                    ir.WriteMemory(8 * ebytes, address, element);
+
+                    address = ir.Add(address, ir.Imm32(static_cast<u32>(ebytes)));
+                }
             }
         }
     }
@@ -140,23 +148,31 @@ bool ArmTranslatorVisitor::v8_VLD_multiple(bool D, Reg n, size_t Vd, Imm<4> type
     const bool wback = m != Reg::R15;
     const bool register_index = m != Reg::R15 && m != Reg::R13;
 
-    for (size_t r = 0; r < regs; r++) {
-        for (size_t i = 0; i < nelem; i++) {
-            const ExtReg ext_reg = d + i * inc + r;
-            ir.SetExtendedRegister(ext_reg, ir.Imm64(0));
-        }
-    }
-
     IR::U32 address = ir.GetRegister(n);
-    for (size_t r = 0; r < regs; r++) {
-        for (size_t e = 0; e < elements; e++) {
+    if (nelem == 1 && !ir.current_location.EFlag()) {
+        // VLD1 loads whole registers back to back.
+        for (size_t r = 0; r < regs; r++) {
+            ir.SetExtendedRegister(d + r, ir.ReadMemory64(address));
+            address = ir.Add(address, ir.Imm32(8));
+        }
+    } else {
+        for (size_t r = 0; r < regs; r++) {
             for (size_t i = 0; i < nelem; i++) {
                 const ExtReg ext_reg = d + i * inc + r;
-                const IR::U64 element = ir.ZeroExtendToLong(ir.ReadMemory(ebytes * 8, address));
-                const IR::U64 shifted_element = ir.LogicalShiftLeft(element, ir.Imm8(static_cast<u8>(e * ebytes * 8)));
-                ir.SetExtendedRegister(ext_reg, ir.Or(ir.GetExtendedRegister(ext_reg), shifted_element));
+                ir.SetExtendedRegister(ext_reg, ir.Imm64(0));
+            }
+        }
+
+        for (size_t r = 0; r < regs; r++) {
+            for (size_t e = 0; e < elements; e++) {
+                for (size_t i = 0; i < nelem; i++) {
+                    const ExtReg ext_reg = d + i * inc + r;
+                    const IR::U64 element = ir.ZeroExtendToLong(ir.ReadMemory(ebytes * 8, address));
+                    const IR::U64 shifted_element = ir.LogicalShiftLeft(element, ir.Imm8(static_cast<u8>(e * ebytes * 8)));
+                    ir.SetExtendedRegister(ext_reg, ir.Or(ir.GetExtendedRegister(ext_reg), shifted_element));
 
-                address = ir.Add(address, ir.Imm32(static_cast<u32>(ebytes)));
+                    address = ir.Add(address, ir.Imm32(static_cast<u32>(ebytes)));
+                }
             }
         }
     }
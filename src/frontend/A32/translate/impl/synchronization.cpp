@@ -49,6 +49,9 @@ bool ArmTranslatorVisitor::arm_SWPB(Cond cond, Reg n, Reg t, Reg t2) {
     return true;
 }
 
+// Load-acquires are followed by an ordering barrier and store-releases are surrounded by them,
+// which together give the sequentially consistent ordering these instructions require.
+
 // LDA<c> <Rt>, [<Rn>]
 bool ArmTranslatorVisitor::arm_LDA(Cond cond, Reg n, Reg t) {
     if (t == Reg::PC || n == Reg::PC) {
@@ -61,6 +64,7 @@ bool ArmTranslatorVisitor::arm_LDA(Cond cond, Reg n, Reg t) {
 
     const auto address = ir.GetRegister(n);
     ir.SetRegister(t, ir.ReadMemory32(address)); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 // LDAB<c> <Rt>, [<Rn>]
@@ -75,6 +79,7 @@ bool ArmTranslatorVisitor::arm_LDAB(Cond cond, Reg n, Reg t) {
 
     const auto address = ir.GetRegister(n);
     ir.SetRegister(t, ir.ZeroExtendToWord(ir.ReadMemory8(address))); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 // LDAH<c> <Rt>, [<Rn>]
@@ -89,6 +94,7 @@ bool ArmTranslatorVisitor::arm_LDAH(Cond cond, Reg n, Reg t) {
 
     const auto address = ir.GetRegister(n);
     ir.SetRegister(t, ir.ZeroExtendToWord(ir.ReadMemory16(address))); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -103,8 +109,8 @@ bool ArmTranslatorVisitor::arm_LDAEX(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 4);
-    ir.SetRegister(t, ir.ReadMemory32(address)); // AccType::Ordered
+    ir.SetRegister(t, ir.ExclusiveReadMemory32(address)); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -119,8 +125,8 @@ bool ArmTranslatorVisitor::arm_LDAEXB(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 1);
-    ir.SetRegister(t, ir.ZeroExtendByteToWord(ir.ReadMemory8(address))); // AccType::Ordered
+    ir.SetRegister(t, ir.ZeroExtendByteToWord(ir.ExclusiveReadMemory8(address))); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -135,13 +141,11 @@ bool ArmTranslatorVisitor::arm_LDAEXD(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 8);
-
     // DO NOT SWAP hi AND lo IN BIG ENDIAN MODE, THIS IS CORRECT BEHAVIOUR
-    const auto lo = ir.ReadMemory32(address); // AccType::Ordered
+    const auto [lo, hi] = ir.ExclusiveReadMemory64(address); // AccType::Ordered
     ir.SetRegister(t, lo);
-    const auto hi = ir.ReadMemory32(ir.Add(address, ir.Imm32(4))); // AccType::Ordered
     ir.SetRegister(t+1, hi);
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -156,8 +160,8 @@ bool ArmTranslatorVisitor::arm_LDAEXH(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 2);
-    ir.SetRegister(t, ir.ZeroExtendHalfToWord(ir.ReadMemory16(address))); // AccType::Ordered
+    ir.SetRegister(t, ir.ZeroExtendHalfToWord(ir.ExclusiveReadMemory16(address))); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -171,8 +175,10 @@ bool ArmTranslatorVisitor::arm_STL(Cond cond, Reg n, Reg t) {
         return true;
     }
 
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     ir.WriteMemory32(address, ir.GetRegister(t)); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -186,8 +192,10 @@ bool ArmTranslatorVisitor::arm_STLB(Cond cond, Reg n, Reg t) {
         return true;
     }
 
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     ir.WriteMemory8(address, ir.LeastSignificantByte(ir.GetRegister(t))); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -201,8 +209,10 @@ bool ArmTranslatorVisitor::arm_STLH(Cond cond, Reg n, Reg t) {
         return true;
     }
 
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     ir.WriteMemory16(address, ir.LeastSignificantHalf(ir.GetRegister(t))); // AccType::Ordered
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -220,10 +230,12 @@ bool ArmTranslatorVisitor::arm_STLEXB(Cond cond, Reg n, Reg d, Reg t) {
         return true;
     }
 
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     const auto value = ir.LeastSignificantByte(ir.GetRegister(t));
     const auto passed = ir.ExclusiveWriteMemory8(address, value); // AccType::Ordered
     ir.SetRegister(d, passed);
+    ir.OrderedAccessBarrier();
     return true;
 }
 // STLEXD<c> <Rd>, <Rt>, <Rt2>, [<Rn>]
@@ -241,11 +253,13 @@ bool ArmTranslatorVisitor::arm_STLEXD(Cond cond, Reg n, Reg d, Reg t) {
     }
 
     const Reg t2 = t + 1;
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     const auto value_lo = ir.GetRegister(t);
     const auto value_hi = ir.GetRegister(t2);
     const auto passed = ir.ExclusiveWriteMemory64(address, value_lo, value_hi); // AccType::Ordered
     ir.SetRegister(d, passed);
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -263,10 +277,12 @@ bool ArmTranslatorVisitor::arm_STLEXH(Cond cond, Reg n, Reg d, Reg t) {
         return true;
     }
 
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     const auto value = ir.LeastSignificantHalf(ir.GetRegister(t));
     const auto passed = ir.ExclusiveWriteMemory16(address, value); // AccType::Ordered
     ir.SetRegister(d, passed);
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -284,10 +300,12 @@ bool ArmTranslatorVisitor::arm_STLEX(Cond cond, Reg n, Reg d, Reg t) {
         return true;
     }
 
+    ir.OrderedAccessBarrier();
     const auto address = ir.GetRegister(n);
     const auto value = ir.GetRegister(t);
     const auto passed = ir.ExclusiveWriteMemory32(address, value);
     ir.SetRegister(d, passed);
+    ir.OrderedAccessBarrier();
     return true;
 }
 
@@ -302,8 +320,7 @@ bool ArmTranslatorVisitor::arm_LDREX(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 4);
-    ir.SetRegister(t, ir.ReadMemory32(address));
+    ir.SetRegister(t, ir.ExclusiveReadMemory32(address));
     return true;
 }
 
@@ -318,8 +335,7 @@ bool ArmTranslatorVisitor::arm_LDREXB(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 1);
-    ir.SetRegister(t, ir.ZeroExtendByteToWord(ir.ReadMemory8(address)));
+    ir.SetRegister(t, ir.ZeroExtendByteToWord(ir.ExclusiveReadMemory8(address)));
     return true;
 }
 
@@ -334,12 +350,9 @@ bool ArmTranslatorVisitor::arm_LDREXD(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 8);
-
     // DO NOT SWAP hi AND lo IN BIG ENDIAN MODE, THIS IS CORRECT BEHAVIOUR
-    const auto lo = ir.ReadMemory32(address);
+    const auto [lo, hi] = ir.ExclusiveReadMemory64(address);
     ir.SetRegister(t, lo);
-    const auto hi = ir.ReadMemory32(ir.Add(address, ir.Imm32(4)));
     ir.SetRegister(t+1, hi);
     return true;
 }
@@ -355,8 +368,7 @@ bool ArmTranslatorVisitor::arm_LDREXH(Cond cond, Reg n, Reg t) {
     }
 
     const auto address = ir.GetRegister(n);
-    ir.SetExclusive(address, 2);
-    ir.SetRegister(t, ir.ZeroExtendHalfToWord(ir.ReadMemory16(address)));
+    ir.SetRegister(t, ir.ZeroExtendHalfToWord(ir.ExclusiveReadMemory16(address)));
     return true;
 }
 
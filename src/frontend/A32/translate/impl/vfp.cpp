@@ -792,7 +792,7 @@ bool ArmTranslatorVisitor::vfp_VMRS(Cond cond, Reg t) {
     if (t == Reg::R15) {
         // This encodes ASPR_nzcv access
         const auto nzcv = ir.GetFpscrNZCV();
-        ir.SetCpsrNZCV(nzcv);
+        ir.SetCpsrNZCVRaw(nzcv);
     } else {
         ir.SetRegister(t, ir.GetFpscr());
     }
@@ -5,15 +5,18 @@
 
 #include "frontend/A32/location_descriptor.h"
 #include "frontend/A32/translate/translate.h"
+#include "frontend/code_reader.h"
 #include "frontend/ir/basic_block.h"
 
 namespace Dynarmic::A32 {
 
-IR::Block TranslateArm(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options);
-IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options);
+IR::Block TranslateArm(LocationDescriptor descriptor, CodeReader<u32>& code_reader, const TranslationOptions& options);
+IR::Block TranslateThumb(LocationDescriptor descriptor, CodeReader<u32>& code_reader, const TranslationOptions& options);
 
-IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options) {
-    return (descriptor.TFlag() ? TranslateThumb : TranslateArm)(descriptor, memory_read_code, options);
+IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options,
+                    MemoryReadCodePageFuncType memory_read_code_page) {
+    CodeReader<u32> code_reader{std::move(memory_read_code), std::move(memory_read_code_page)};
+    return (descriptor.TFlag() ? TranslateThumb : TranslateArm)(descriptor, code_reader, options);
 }
 
 bool TranslateSingleArmInstruction(IR::Block& block, LocationDescriptor descriptor, u32 instruction);
@@ -15,6 +15,7 @@ namespace Dynarmic::A32 {
 class LocationDescriptor;
 
 using MemoryReadCodeFuncType = std::function<u32(u32 vaddr)>;
+using MemoryReadCodePageFuncType = std::function<const u8*(u32 vaddr)>;
 
 struct TranslationOptions {
     /// This changes what IR we emit when we translate an unpredictable instruction.
@@ -33,9 +34,13 @@ struct TranslationOptions {
  * @param descriptor The starting location of the basic block. Includes information like PC, Thumb state, &c.
  * @param memory_read_code The function we should use to read emulated memory.
  * @param options Configures how certain instructions are translated.
+ * @param memory_read_code_page Optionally returns a host pointer to the start of the code page containing a
+ *                              given address, from which instructions are then read instead of through
+ *                              memory_read_code. May return nullptr.
  * @return A translated basic block in the intermediate representation.
  */
-IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options);
+IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options,
+                    MemoryReadCodePageFuncType memory_read_code_page = {});
 
 /**
  * This function translates a single provided instruction into our intermediate representation.
@@ -9,6 +9,7 @@
 
 #include "common/assert.h"
 #include "common/bit_util.h"
+#include "frontend/code_reader.h"
 #include "frontend/imm.h"
 #include "frontend/A32/decoder/thumb16.h"
 #include "frontend/A32/decoder/thumb32.h"
@@ -28,8 +29,8 @@ bool IsThumb16(u16 first_part) {
     return (first_part & 0xF800) <= 0xE800;
 }
 
-std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFuncType memory_read_code) {
-    u32 first_part = memory_read_code(arm_pc & 0xFFFFFFFC);
+std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, CodeReader<u32>& code_reader) {
+    u32 first_part = code_reader.Read(arm_pc & 0xFFFFFFFC);
     if ((arm_pc & 0x2) != 0) {
         first_part >>= 16;
     }
@@ -43,7 +44,7 @@ std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFu
     // 32-bit thumb instruction
     // These always start with 0b11101, 0b11110 or 0b11111.
 
-    u32 second_part = memory_read_code((arm_pc + 2) & 0xFFFFFFFC);
+    u32 second_part = code_reader.Read((arm_pc + 2) & 0xFFFFFFFC);
     if (((arm_pc + 2) & 0x2) != 0) {
         second_part >>= 16;
     }
@@ -54,7 +55,7 @@ std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFu
 
 } // local namespace
 
-IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options) {
+IR::Block TranslateThumb(LocationDescriptor descriptor, CodeReader<u32>& code_reader, const TranslationOptions& options) {
     const bool single_step = descriptor.SingleStepping();
 
     IR::Block block{descriptor};
@@ -63,7 +64,7 @@ IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType m
     bool should_continue = true;
     do {
         const u32 arm_pc = visitor.ir.current_location.PC();
-        const auto [thumb_instruction, inst_size] = ReadThumbInstruction(arm_pc, memory_read_code);
+        const auto [thumb_instruction, inst_size] = ReadThumbInstruction(arm_pc, code_reader);
 
         if (inst_size == ThumbInstSize::Thumb16) {
             if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
@@ -68,6 +68,10 @@ void IREmitter::InstructionSynchronizationBarrier() {
     Inst(Opcode::A64InstructionSynchronizationBarrier);
 }
 
+void IREmitter::OrderedAccessBarrier() {
+    Inst(Opcode::A64OrderedAccessBarrier);
+}
+
 IR::U32 IREmitter::GetCNTFRQ() {
     return Inst<IR::U32>(Opcode::A64GetCNTFRQ);
 }
@@ -45,6 +45,7 @@ public:
     void DataSynchronizationBarrier();
     void DataMemoryBarrier();
     void InstructionSynchronizationBarrier();
+    void OrderedAccessBarrier();
     IR::U32 GetCNTFRQ();
     IR::U64 GetCNTPCT(); // TODO: Ensure sub-basic-block cycle counts are updated before this.
     IR::U32 GetCTR();
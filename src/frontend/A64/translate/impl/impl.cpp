@@ -269,77 +269,114 @@ void TranslatorVisitor::Vpart_scalar(size_t bitsize, Vec vec, size_t part, IR::U
     }
 }
 
-IR::UAnyU128 TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, IR::AccType /*acc_type*/) {
-    switch (bytesize) {
-    case 1:
-        return ir.ReadMemory8(address);
-    case 2:
-        return ir.ReadMemory16(address);
-    case 4:
-        return ir.ReadMemory32(address);
-    case 8:
-        return ir.ReadMemory64(address);
-    case 16:
-        return ir.ReadMemory128(address);
-    default:
-        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+static bool IsOrdered(IR::AccType acc_type) {
+    return acc_type == IR::AccType::ORDERED || acc_type == IR::AccType::ORDEREDRW || acc_type == IR::AccType::LIMITEDORDERED;
+}
+
+IR::UAnyU128 TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, IR::AccType acc_type) {
+    const IR::UAnyU128 value = [&]() -> IR::UAnyU128 {
+        switch (bytesize) {
+        case 1:
+            return ir.ReadMemory8(address);
+        case 2:
+            return ir.ReadMemory16(address);
+        case 4:
+            return ir.ReadMemory32(address);
+        case 8:
+            return ir.ReadMemory64(address);
+        case 16:
+            return ir.ReadMemory128(address);
+        default:
+            ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+        }
+    }();
+
+    if (IsOrdered(acc_type)) {
+        ir.OrderedAccessBarrier();
     }
+    return value;
 }
 
-void TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, IR::AccType /*acc_type*/, IR::UAnyU128 value) {
+void TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, IR::AccType acc_type, IR::UAnyU128 value) {
+    if (IsOrdered(acc_type)) {
+        ir.OrderedAccessBarrier();
+    }
+
     switch (bytesize) {
     case 1:
         ir.WriteMemory8(address, value);
-        return;
+        break;
     case 2:
         ir.WriteMemory16(address, value);
-        return;
+        break;
     case 4:
         ir.WriteMemory32(address, value);
-        return;
+        break;
     case 8:
         ir.WriteMemory64(address, value);
-        return;
+        break;
     case 16:
         ir.WriteMemory128(address, value);
-        return;
+        break;
     default:
         ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
     }
+
+    if (IsOrdered(acc_type)) {
+        ir.OrderedAccessBarrier();
+    }
 }
 
-IR::UAnyU128 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, IR::AccType /*acctype*/) {
-    switch (bytesize) {
-    case 1:
-        return ir.ExclusiveReadMemory8(address);
-    case 2:
-        return ir.ExclusiveReadMemory16(address);
-    case 4:
-        return ir.ExclusiveReadMemory32(address);
-    case 8:
-        return ir.ExclusiveReadMemory64(address);
-    case 16:
-        return ir.ExclusiveReadMemory128(address);
-    default:
-        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+IR::UAnyU128 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, IR::AccType acc_type) {
+    const IR::UAnyU128 value = [&]() -> IR::UAnyU128 {
+        switch (bytesize) {
+        case 1:
+            return ir.ExclusiveReadMemory8(address);
+        case 2:
+            return ir.ExclusiveReadMemory16(address);
+        case 4:
+            return ir.ExclusiveReadMemory32(address);
+        case 8:
+            return ir.ExclusiveReadMemory64(address);
+        case 16:
+            return ir.ExclusiveReadMemory128(address);
+        default:
+            ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+        }
+    }();
+
+    if (IsOrdered(acc_type)) {
+        ir.OrderedAccessBarrier();
     }
+    return value;
 }
 
-IR::U32 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, IR::AccType /*acctype*/, IR::UAnyU128 value) {
-    switch (bytesize) {
-    case 1:
-        return ir.ExclusiveWriteMemory8(address, value);
-    case 2:
-        return ir.ExclusiveWriteMemory16(address, value);
-    case 4:
-        return ir.ExclusiveWriteMemory32(address, value);
-    case 8:
-        return ir.ExclusiveWriteMemory64(address, value);
-    case 16:
-        return ir.ExclusiveWriteMemory128(address, value);
-    default:
-        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+IR::U32 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, IR::AccType acc_type, IR::UAnyU128 value) {
+    if (IsOrdered(acc_type)) {
+        ir.OrderedAccessBarrier();
+    }
+
+    const IR::U32 status = [&]() -> IR::U32 {
+        switch (bytesize) {
+        case 1:
+            return ir.ExclusiveWriteMemory8(address, value);
+        case 2:
+            return ir.ExclusiveWriteMemory16(address, value);
+        case 4:
+            return ir.ExclusiveWriteMemory32(address, value);
+        case 8:
+            return ir.ExclusiveWriteMemory64(address, value);
+        case 16:
+            return ir.ExclusiveWriteMemory128(address, value);
+        default:
+            ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+        }
+    }();
+
+    if (IsOrdered(acc_type)) {
+        ir.OrderedAccessBarrier();
     }
+    return status;
 }
 
 IR::U32U64 TranslatorVisitor::SignExtend(IR::UAny value, size_t to_size) {
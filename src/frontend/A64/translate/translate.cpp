@@ -7,13 +7,16 @@
 #include "frontend/A64/location_descriptor.h"
 #include "frontend/A64/translate/impl/impl.h"
 #include "frontend/A64/translate/translate.h"
+#include "frontend/code_reader.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/terminal.h"
 
 namespace Dynarmic::A64 {
 
-IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options) {
+IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options,
+                    MemoryReadCodePageFuncType memory_read_code_page) {
     const bool single_step = descriptor.SingleStepping();
+    CodeReader<u64> code_reader{std::move(memory_read_code), std::move(memory_read_code_page)};
 
     IR::Block block{descriptor};
     TranslatorVisitor visitor{block, descriptor, std::move(options)};
@@ -21,7 +24,7 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
     bool should_continue = true;
     do {
         const u64 pc = visitor.ir.current_location->PC();
-        const u32 instruction = memory_read_code(pc);
+        const u32 instruction = code_reader.Read(pc);
 
         if (auto decoder = Decode<TranslatorVisitor>(instruction)) {
             should_continue = decoder->get().call(visitor, instruction);
@@ -0,0 +1,66 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <cstring>
+#include <functional>
+
+#include "common/common_types.h"
+
+namespace Dynarmic {
+
+/**
+ * Reads instruction words for the translators.
+ *
+ * Words are read directly from host memory when the embedder provides a host pointer to the code page
+ * that contains them, and through the per-word callback otherwise. The page callback is only called
+ * again once translation moves on to another page.
+ */
+template <typename VAddr>
+class CodeReader final {
+public:
+    using ReadCodeFuncType = std::function<u32(VAddr vaddr)>;
+    using GetCodePageFuncType = std::function<const u8*(VAddr vaddr)>;
+
+    static constexpr VAddr page_size = 4096;
+    static constexpr VAddr page_mask = page_size - 1;
+
+    CodeReader(ReadCodeFuncType read_code, GetCodePageFuncType get_code_page)
+        : read_code(std::move(read_code)), get_code_page(std::move(get_code_page)) {}
+
+    /// Reads the little-endian word at vaddr.
+    u32 Read(VAddr vaddr) {
+        const VAddr page_offset = vaddr & page_mask;
+        if (!get_code_page || page_offset > page_size - 4) {
+            return read_code(vaddr);
+        }
+
+        const VAddr page_base = vaddr & ~page_mask;
+        if (!current_page_valid || current_page_base != page_base) {
+            current_page = get_code_page(page_base);
+            current_page_base = page_base;
+            current_page_valid = true;
+        }
+
+        if (!current_page) {
+            return read_code(vaddr);
+        }
+
+        u32 word;
+        std::memcpy(&word, current_page + page_offset, sizeof(word));
+        return word;
+    }
+
+private:
+    ReadCodeFuncType read_code;
+    GetCodePageFuncType get_code_page;
+
+    bool current_page_valid = false;
+    VAddr current_page_base = 0;
+    const u8* current_page = nullptr;
+};
+
+} // namespace Dynarmic
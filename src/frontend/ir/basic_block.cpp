@@ -7,6 +7,7 @@
 #include <initializer_list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -21,9 +22,39 @@
 
 namespace Dynarmic::IR {
 
+namespace {
+
+// Blocks are short-lived and there are rarely more than a couple alive on a thread at once
+// (the block being compiled, and temporary blocks created by some passes). Recycling their
+// instruction pools means that after warm-up, translation does not touch the system allocator.
+constexpr size_t max_cached_pools = 4;
+thread_local std::vector<std::unique_ptr<Common::Pool>> pool_cache;
+
+Common::Pool* AcquirePool() {
+    if (pool_cache.empty()) {
+        return new Common::Pool(sizeof(Inst), 4096);
+    }
+
+    Common::Pool* pool = pool_cache.back().release();
+    pool_cache.pop_back();
+    return pool;
+}
+
+} // anonymous namespace
+
+void Block::PoolReleaser::operator()(Common::Pool* pool) const {
+    if (pool_cache.size() >= max_cached_pools) {
+        delete pool;
+        return;
+    }
+
+    pool->Reset();
+    pool_cache.emplace_back(pool);
+}
+
 Block::Block(const LocationDescriptor& location)
     : location{location}, end_location{location}, cond{Cond::AL},
-      instruction_alloc_pool{std::make_unique<Common::Pool>(sizeof(Inst), 4096)} {}
+      instruction_alloc_pool{AcquirePool()} {}
 
 Block::~Block() = default;
 
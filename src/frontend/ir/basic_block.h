@@ -24,7 +24,7 @@ class Pool;
 namespace Dynarmic::IR {
 
 enum class Cond;
-enum class Opcode;
+enum class Opcode : u16;
 
 /**
  * A basic block. It consists of zero or more instructions followed by exactly one terminal.
@@ -152,8 +152,12 @@ private:
 
     /// List of instructions in this block.
     InstructionList instructions;
+    /// Returns instruction pools to a per-thread cache for reuse by later blocks.
+    struct PoolReleaser {
+        void operator()(Common::Pool* pool) const;
+    };
     /// Memory pool for instruction list
-    std::unique_ptr<Common::Pool> instruction_alloc_pool;
+    std::unique_ptr<Common::Pool, PoolReleaser> instruction_alloc_pool;
     /// Terminal instruction of this block.
     Terminal terminal = Term::Invalid{};
 
@@ -4,6 +4,7 @@
  */
 
 #include <algorithm>
+#include <initializer_list>
 
 #include <fmt/ostream.h>
 
@@ -49,9 +50,11 @@ bool Inst::IsBarrier() const {
     case Opcode::A32DataMemoryBarrier:
     case Opcode::A32DataSynchronizationBarrier:
     case Opcode::A32InstructionSynchronizationBarrier:
+    case Opcode::A32OrderedAccessBarrier:
     case Opcode::A64DataMemoryBarrier:
     case Opcode::A64DataSynchronizationBarrier:
     case Opcode::A64InstructionSynchronizationBarrier:
+    case Opcode::A64OrderedAccessBarrier:
         return true;
 
     default:
@@ -65,11 +68,14 @@ bool Inst::IsSharedMemoryRead() const {
     case Opcode::A32ReadMemory16:
     case Opcode::A32ReadMemory32:
     case Opcode::A32ReadMemory64:
+    case Opcode::A32ReadMemory128:
     case Opcode::A64ReadMemory8:
     case Opcode::A64ReadMemory16:
     case Opcode::A64ReadMemory32:
     case Opcode::A64ReadMemory64:
     case Opcode::A64ReadMemory128:
+    case Opcode::A32ReadMemoryBlock:
+    case Opcode::A64ReadMemoryBlock:
         return true;
 
     default:
@@ -83,11 +89,14 @@ bool Inst::IsSharedMemoryWrite() const {
     case Opcode::A32WriteMemory16:
     case Opcode::A32WriteMemory32:
     case Opcode::A32WriteMemory64:
+    case Opcode::A32WriteMemory128:
     case Opcode::A64WriteMemory8:
     case Opcode::A64WriteMemory16:
     case Opcode::A64WriteMemory32:
     case Opcode::A64WriteMemory64:
     case Opcode::A64WriteMemory128:
+    case Opcode::A32WriteMemoryBlock:
+    case Opcode::A64WriteMemoryBlock:
         return true;
 
     default:
@@ -101,6 +110,10 @@ bool Inst::IsSharedMemoryReadOrWrite() const {
 
 bool Inst::IsExclusiveMemoryRead() const {
     switch (op) {
+    case Opcode::A32ExclusiveReadMemory8:
+    case Opcode::A32ExclusiveReadMemory16:
+    case Opcode::A32ExclusiveReadMemory32:
+    case Opcode::A32ExclusiveReadMemory64:
     case Opcode::A64ExclusiveReadMemory8:
     case Opcode::A64ExclusiveReadMemory16:
     case Opcode::A64ExclusiveReadMemory32:
@@ -143,6 +156,20 @@ bool Inst::IsMemoryReadOrWrite() const {
     return IsMemoryRead() || IsMemoryWrite();
 }
 
+bool Inst::WritesToMemoryBlock() const {
+    switch (op) {
+    case Opcode::SetMemoryBlock32:
+    case Opcode::SetMemoryBlock64:
+    case Opcode::SetMemoryBlock128:
+    case Opcode::A32ReadMemoryBlock:
+    case Opcode::A64ReadMemoryBlock:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 bool Inst::ReadsFromCPSR() const {
     switch (op) {
     case Opcode::A32GetCpsr:
@@ -470,7 +497,6 @@ bool Inst::CausesCPUException() const {
 
 bool Inst::AltersExclusiveState() const {
     return op == Opcode::A32ClearExclusive ||
-           op == Opcode::A32SetExclusive   ||
            op == Opcode::A64ClearExclusive ||
            IsExclusiveMemoryRead()         ||
            IsExclusiveMemoryWrite();
@@ -510,6 +536,7 @@ bool Inst::MayHaveSideEffects() const {
            WritesToFPSR()                               ||
            AltersExclusiveState()                       ||
            IsMemoryWrite()                              ||
+           WritesToMemoryBlock()                        ||
            IsCoprocessorInstruction();
 }
 
@@ -585,6 +612,15 @@ Inst* Inst::GetAssociatedPseudoOperation(Opcode opcode) {
     ASSERT_FALSE("Not a valid pseudo-operation");
 }
 
+void Inst::InvalidateUnusedPseudoOperations() {
+    // carry_inst, ge_inst and upper_inst share storage, as do nzcv_inst and lower_inst.
+    for (Inst* pseudo_inst : {carry_inst, overflow_inst, nzcv_inst}) {
+        if (pseudo_inst && !pseudo_inst->HasUses()) {
+            pseudo_inst->Invalidate();
+        }
+    }
+}
+
 Type Inst::GetType() const {
     if (op == Opcode::Identity)
         return args[0].GetType();
@@ -642,6 +678,15 @@ void Inst::ReplaceUsesWith(Value replacement) {
     args[0] = replacement;
 }
 
+void Inst::ReplaceOpcode(Opcode opcode) {
+    ASSERT_MSG(GetNumArgsOf(opcode) == GetNumArgsOf(op), "Inst::ReplaceOpcode: {} and {} take a different number of arguments", op, opcode);
+    ASSERT(!IsAPseudoOperation());
+
+    op = opcode;
+
+    ASSERT(!IsAPseudoOperation());
+}
+
 void Inst::Use(const Value& value) {
     value.GetInst()->use_count++;
 
@@ -13,7 +13,7 @@
 
 namespace Dynarmic::IR {
 
-enum class Opcode;
+enum class Opcode : u16;
 enum class Type;
 
 constexpr size_t max_arg_count = 4;
@@ -56,6 +56,9 @@ public:
     /// Determines whether or not this instruction performs any kind of memory access.
     bool IsMemoryReadOrWrite() const;
 
+    /// Determines whether or not this instruction writes to the memory block buffer.
+    bool WritesToMemoryBlock() const;
+
     /// Determines whether or not this instruction reads from the CPSR.
     bool ReadsFromCPSR() const;
     /// Determines whether or not this instruction writes to the CPSR.
@@ -123,6 +126,8 @@ public:
     bool HasAssociatedPseudoOperation() const;
     /// Gets a pseudo-operation associated with this instruction.
     Inst* GetAssociatedPseudoOperation(Opcode opcode);
+    /// Invalidates all pseudo-operations associated with this instruction that have no uses.
+    void InvalidateUnusedPseudoOperations();
 
     /// Get the microop this microinstruction represents.
     Opcode GetOpcode() const { return op; }
@@ -139,12 +144,18 @@ public:
 
     void ReplaceUsesWith(Value replacement);
 
+    /// Changes the operation this instruction performs, keeping its arguments.
+    /// The new opcode must take the same number of arguments; argument types are
+    /// only checked when they are subsequently modified via SetArg.
+    void ReplaceOpcode(Opcode opcode);
+
 private:
     void Use(const Value& value);
     void UndoUse(const Value& value);
 
+    // Members are ordered such that op and use_count fit in the tail padding of IntrusiveListNode.
     Opcode op;
-    size_t use_count = 0;
+    u32 use_count = 0;
     std::array<Value, max_arg_count> args;
 
     // Pointers to related pseudooperations:
@@ -160,5 +171,6 @@ private:
         Inst* lower_inst;
     };
 };
+static_assert(sizeof(Inst) <= 96, "IR::Inst should be kept small in size");
 
 } // namespace Dynarmic::IR
@@ -18,7 +18,7 @@ enum class Type;
  * The Opcodes of our intermediate representation.
  * Type signatures for each opcode can be found in opcodes.inc
  */
-enum class Opcode {
+enum class Opcode : u16 {
 #define OPCODE(name, type, ...) name,
 #define A32OPC(name, type, ...) A32##name,
 #define A64OPC(name, type, ...) A64##name,
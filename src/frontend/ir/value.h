@@ -29,7 +29,11 @@ enum class Cond;
 /**
  * A representation of a value in the IR.
  * A value may either be an immediate or the result of a microinstruction.
+ *
+ * Values are only 4-byte aligned. This removes 4 bytes of padding from each Value,
+ * which adds up as every IR::Inst stores max_arg_count of them.
  */
+#pragma pack(push, 4)
 class Value {
 public:
     using CoprocessorInfo = std::array<u8, 8>;
@@ -140,7 +144,8 @@ private:
         Cond imm_cond;
     } inner;
 };
-static_assert(sizeof(Value) <= 2 * sizeof(u64), "IR::Value should be kept small in size");
+#pragma pack(pop)
+static_assert(sizeof(Value) <= 12, "IR::Value should be kept small in size");
 
 template <Type type_>
 class TypedValue final : public Value {
@@ -3,16 +3,34 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <optional>
+
 #include <dynarmic/A32/config.h>
 
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/opcodes.h"
+#include "ir_opt/memory_address.h"
 #include "ir_opt/passes.h"
 
 namespace Dynarmic::Optimization {
 
+namespace {
+
+// The address of a memory read, if it is a constant. Literal loads have an immediate address,
+// while loads relative to an ADR are left as an addition of immediates until constant propagation.
+std::optional<u32> ConstantAddress(const IR::Inst& inst) {
+    const MemoryAddress address = DecomposeMemoryAddress<IR::Opcode::Add32, IR::Opcode::Sub32, 0xFFFF'FFFFull>(inst.GetArg(0));
+    if (address.base) {
+        return std::nullopt;
+    }
+    return static_cast<u32>(address.offset);
+}
+
+} // anonymous namespace
+
 void A32ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
-    for (auto& inst : block) {
+    for (auto iter = block.begin(); iter != block.end(); iter++) {
+        auto& inst = *iter;
         switch (inst.GetOpcode()) {
         case IR::Opcode::A32SetCFlag: {
             const IR::Value arg = inst.GetArg(0);
@@ -22,53 +40,48 @@ void A32ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb) {
             break;
         }
         case IR::Opcode::A32ReadMemory8: {
-            if (!inst.AreAllArgsImmediates()) {
-                break;
-            }
-
-            const u32 vaddr = inst.GetArg(0).GetU32();
-            if (cb->IsReadOnlyMemory(vaddr)) {
-                const u8 value_from_memory = cb->MemoryRead8(vaddr);
+            const auto vaddr = ConstantAddress(inst);
+            if (vaddr && cb->IsReadOnlyMemory(*vaddr)) {
+                const u8 value_from_memory = cb->MemoryRead8(*vaddr);
                 inst.ReplaceUsesWith(IR::Value{value_from_memory});
             }
             break;
         }
         case IR::Opcode::A32ReadMemory16: {
-            if (!inst.AreAllArgsImmediates()) {
-                break;
-            }
-
-            const u32 vaddr = inst.GetArg(0).GetU32();
-            if (cb->IsReadOnlyMemory(vaddr)) {
-                const u16 value_from_memory = cb->MemoryRead16(vaddr);
+            const auto vaddr = ConstantAddress(inst);
+            if (vaddr && cb->IsReadOnlyMemory(*vaddr)) {
+                const u16 value_from_memory = cb->MemoryRead16(*vaddr);
                 inst.ReplaceUsesWith(IR::Value{value_from_memory});
             }
             break;
         }
         case IR::Opcode::A32ReadMemory32: {
-            if (!inst.AreAllArgsImmediates()) {
-                break;
-            }
-
-            const u32 vaddr = inst.GetArg(0).GetU32();
-            if (cb->IsReadOnlyMemory(vaddr)) {
-                const u32 value_from_memory = cb->MemoryRead32(vaddr);
+            const auto vaddr = ConstantAddress(inst);
+            if (vaddr && cb->IsReadOnlyMemory(*vaddr)) {
+                const u32 value_from_memory = cb->MemoryRead32(*vaddr);
                 inst.ReplaceUsesWith(IR::Value{value_from_memory});
             }
             break;
         }
         case IR::Opcode::A32ReadMemory64: {
-            if (!inst.AreAllArgsImmediates()) {
-                break;
-            }
-
-            const u32 vaddr = inst.GetArg(0).GetU32();
-            if (cb->IsReadOnlyMemory(vaddr)) {
-                const u64 value_from_memory = cb->MemoryRead64(vaddr);
+            const auto vaddr = ConstantAddress(inst);
+            if (vaddr && cb->IsReadOnlyMemory(*vaddr)) {
+                const u64 value_from_memory = cb->MemoryRead64(*vaddr);
                 inst.ReplaceUsesWith(IR::Value{value_from_memory});
             }
             break;
         }
+        case IR::Opcode::A32ReadMemory128: {
+            const auto vaddr = ConstantAddress(inst);
+            if (vaddr && cb->IsReadOnlyMemory(*vaddr) && cb->IsReadOnlyMemory(*vaddr + 8)) {
+                // There are no 128-bit immediates; the backend loads a pack of immediates from its constant pool.
+                const u64 lo = cb->MemoryRead64(*vaddr);
+                const u64 hi = cb->MemoryRead64(*vaddr + 8);
+                const auto pack = block.PrependNewInst(iter, IR::Opcode::Pack2x64To1x128, {IR::Value{lo}, IR::Value{hi}});
+                inst.ReplaceUsesWith(IR::Value{&*pack});
+            }
+            break;
+        }
         default:
             break;
         }
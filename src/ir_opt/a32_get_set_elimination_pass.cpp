@@ -148,6 +148,18 @@ void A32GetSetElimination(IR::Block& block) {
             do_get(cpsr_info.v, inst);
             break;
         }
+        case IR::Opcode::A32SetCpsrNZCV: {
+            // Overwrites all four flags at once, so earlier individual flag sets are dead.
+            // The new flag values are not known individually.
+            for (RegisterInfo* info : {&cpsr_info.n, &cpsr_info.z, &cpsr_info.c, &cpsr_info.v}) {
+                if (info->set_instruction_present) {
+                    info->last_set_instruction->Invalidate();
+                    block.Instructions().erase(info->last_set_instruction);
+                }
+                *info = {};
+            }
+            break;
+        }
         case IR::Opcode::A32SetGEFlags: {
             do_set(cpsr_info.ge, inst->GetArg(0), inst);
             break;
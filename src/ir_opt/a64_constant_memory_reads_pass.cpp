@@ -0,0 +1,76 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <dynarmic/A64/config.h>
+
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/opcodes.h"
+#include "ir_opt/memory_address.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+void A64ConstantMemoryReads(IR::Block& block, A64::UserCallbacks* cb) {
+    for (auto iter = block.begin(); iter != block.end(); ++iter) {
+        auto& inst = *iter;
+
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64ReadMemory8:
+        case IR::Opcode::A64ReadMemory16:
+        case IR::Opcode::A64ReadMemory32:
+        case IR::Opcode::A64ReadMemory64:
+        case IR::Opcode::A64ReadMemory128:
+            break;
+        default:
+            continue;
+        }
+
+        // Literal loads have an immediate address, while ADRP-relative loads are left as
+        // an addition of immediates until constant propagation has run.
+        const MemoryAddress address = DecomposeMemoryAddress<IR::Opcode::Add64, IR::Opcode::Sub64, ~u64(0)>(inst.GetArg(0));
+        if (address.base) {
+            continue;
+        }
+
+        const u64 vaddr = address.offset;
+        if (!cb->IsReadOnlyMemory(vaddr)) {
+            continue;
+        }
+
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64ReadMemory8: {
+            const u8 value_from_memory = cb->MemoryRead8(vaddr);
+            inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            break;
+        }
+        case IR::Opcode::A64ReadMemory16: {
+            const u16 value_from_memory = cb->MemoryRead16(vaddr);
+            inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            break;
+        }
+        case IR::Opcode::A64ReadMemory32: {
+            const u32 value_from_memory = cb->MemoryRead32(vaddr);
+            inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            break;
+        }
+        case IR::Opcode::A64ReadMemory64: {
+            const u64 value_from_memory = cb->MemoryRead64(vaddr);
+            inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            break;
+        }
+        case IR::Opcode::A64ReadMemory128: {
+            // There are no 128-bit immediates; the backend loads a pack of immediates from its constant pool.
+            const A64::Vector value_from_memory = cb->MemoryRead128(vaddr);
+            const auto pack = block.PrependNewInst(iter, IR::Opcode::Pack2x64To1x128, {IR::Value{value_from_memory[0]}, IR::Value{value_from_memory[1]}});
+            inst.ReplaceUsesWith(IR::Value{&*pack});
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
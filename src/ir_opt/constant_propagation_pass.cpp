@@ -4,11 +4,13 @@
  */
 
 #include <optional>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/safe_ops.h"
 #include "common/common_types.h"
+#include "common/iterator_util.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/ir_emitter.h"
 #include "frontend/ir/opcodes.h"
@@ -361,179 +363,242 @@ void FoldZeroExtendXToLong(IR::Inst& inst) {
     const u64 value = inst.GetArg(0).GetImmediateAsU64();
     inst.ReplaceUsesWith(IR::Value{value});
 }
+
+void FoldInstruction(IR::Inst& inst) {
+    const auto opcode = inst.GetOpcode();
+
+    switch (opcode) {
+    case Op::LeastSignificantWord:
+        FoldLeastSignificantWord(inst);
+        break;
+    case Op::MostSignificantWord:
+        FoldMostSignificantWord(inst);
+        break;
+    case Op::LeastSignificantHalf:
+        FoldLeastSignificantHalf(inst);
+        break;
+    case Op::LeastSignificantByte:
+        FoldLeastSignificantByte(inst);
+        break;
+    case Op::MostSignificantBit:
+        FoldMostSignificantBit(inst);
+        break;
+    case Op::IsZero32:
+        if (inst.AreAllArgsImmediates()) {
+            inst.ReplaceUsesWith(IR::Value{inst.GetArg(0).GetU32() == 0});
+        }
+        break;
+    case Op::IsZero64:
+        if (inst.AreAllArgsImmediates()) {
+            inst.ReplaceUsesWith(IR::Value{inst.GetArg(0).GetU64() == 0});
+        }
+        break;
+    case Op::LogicalShiftLeft32:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, true, Safe::LogicalShiftLeft<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::LogicalShiftLeft64:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, false, Safe::LogicalShiftLeft<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::LogicalShiftRight32:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, true, Safe::LogicalShiftRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::LogicalShiftRight64:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, false, Safe::LogicalShiftRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::ArithmeticShiftRight32:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, true, Safe::ArithmeticShiftRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::ArithmeticShiftRight64:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, false, Safe::ArithmeticShiftRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::RotateRight32:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, true, Common::RotateRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::RotateRight64:
+        if (FoldShifts(inst)) {
+            ReplaceUsesWith(inst, false, Common::RotateRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
+        }
+        break;
+    case Op::LogicalShiftLeftMasked32:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, true, inst.GetArg(0).GetU32() << (inst.GetArg(1).GetU32() & 0x1f));
+        }
+        break;
+    case Op::LogicalShiftLeftMasked64:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, false, inst.GetArg(0).GetU64() << (inst.GetArg(1).GetU64() & 0x3f));
+        }
+        break;
+    case Op::LogicalShiftRightMasked32:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, true, inst.GetArg(0).GetU32() >> (inst.GetArg(1).GetU32() & 0x1f));
+        }
+        break;
+    case Op::LogicalShiftRightMasked64:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, false, inst.GetArg(0).GetU64() >> (inst.GetArg(1).GetU64() & 0x3f));
+        }
+        break;
+    case Op::ArithmeticShiftRightMasked32:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, true, static_cast<s32>(inst.GetArg(0).GetU32()) >> (inst.GetArg(1).GetU32() & 0x1f));
+        }
+        break;
+    case Op::ArithmeticShiftRightMasked64:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, false, static_cast<s64>(inst.GetArg(0).GetU64()) >> (inst.GetArg(1).GetU64() & 0x3f));
+        }
+        break;
+    case Op::RotateRightMasked32:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, true, Common::RotateRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU32()));
+        }
+        break;
+    case Op::RotateRightMasked64:
+        if (inst.AreAllArgsImmediates()) {
+            ReplaceUsesWith(inst, false, Common::RotateRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU64()));
+        }
+        break;
+    case Op::Add32:
+    case Op::Add64:
+        FoldAdd(inst, opcode == Op::Add32);
+        break;
+    case Op::Sub32:
+    case Op::Sub64:
+        FoldSub(inst, opcode == Op::Sub32);
+        break;
+    case Op::Mul32:
+    case Op::Mul64:
+        FoldMultiply(inst, opcode == Op::Mul32);
+        break;
+    case Op::SignedDiv32:
+    case Op::SignedDiv64:
+        FoldDivide(inst, opcode == Op::SignedDiv32, true);
+        break;
+    case Op::UnsignedDiv32:
+    case Op::UnsignedDiv64:
+        FoldDivide(inst, opcode == Op::UnsignedDiv32, false);
+        break;
+    case Op::And32:
+    case Op::And64:
+        FoldAND(inst, opcode == Op::And32);
+        break;
+    case Op::Eor32:
+    case Op::Eor64:
+        FoldEOR(inst, opcode == Op::Eor32);
+        break;
+    case Op::Or32:
+    case Op::Or64:
+        FoldOR(inst, opcode == Op::Or32);
+        break;
+    case Op::Not32:
+    case Op::Not64:
+        FoldNOT(inst, opcode == Op::Not32);
+        break;
+    case Op::SignExtendByteToWord:
+    case Op::SignExtendHalfToWord:
+        FoldSignExtendXToWord(inst);
+        break;
+    case Op::SignExtendByteToLong:
+    case Op::SignExtendHalfToLong:
+    case Op::SignExtendWordToLong:
+        FoldSignExtendXToLong(inst);
+        break;
+    case Op::ZeroExtendByteToWord:
+    case Op::ZeroExtendHalfToWord:
+        FoldZeroExtendXToWord(inst);
+        break;
+    case Op::ZeroExtendByteToLong:
+    case Op::ZeroExtendHalfToLong:
+    case Op::ZeroExtendWordToLong:
+        FoldZeroExtendXToLong(inst);
+        break;
+    case Op::ByteReverseWord:
+    case Op::ByteReverseHalf:
+    case Op::ByteReverseDual:
+        FoldByteReverse(inst, opcode);
+        break;
+    default:
+        break;
+    }
+}
+
+// Replaces arguments that refer to Identity instructions with the values they forward.
+// Pseudo-operations are left alone, as their argument determines what they operate on.
+void SkipIdentities(IR::Inst& inst) {
+    if (inst.IsAPseudoOperation()) {
+        return;
+    }
+
+    const size_t num_args = inst.NumArgs();
+    for (size_t i = 0; i < num_args; i++) {
+        IR::Value arg = inst.GetArg(i);
+        if (!arg.IsIdentity()) {
+            continue;
+        }
+        while (arg.IsIdentity()) {
+            arg = arg.GetInst()->GetArg(0);
+        }
+        inst.SetArg(i, arg);
+    }
+}
+
+bool IsRemovable(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case Op::Void:
+        return true;
+    case Op::Identity:
+        // All non-pseudo-operation users have already been redirected by SkipIdentities.
+        return !inst.HasAssociatedPseudoOperation();
+    default:
+        return !inst.HasUses() && !inst.MayHaveSideEffects();
+    }
+}
+
 } // Anonymous namespace
 
 void ConstantPropagation(IR::Block& block) {
     for (auto& inst : block) {
-        const auto opcode = inst.GetOpcode();
-
-        switch (opcode) {
-        case Op::LeastSignificantWord:
-            FoldLeastSignificantWord(inst);
-            break;
-        case Op::MostSignificantWord:
-            FoldMostSignificantWord(inst);
-            break;
-        case Op::LeastSignificantHalf:
-            FoldLeastSignificantHalf(inst);
-            break;
-        case Op::LeastSignificantByte:
-            FoldLeastSignificantByte(inst);
-            break;
-        case Op::MostSignificantBit:
-            FoldMostSignificantBit(inst);
-            break;
-        case Op::IsZero32:
-            if (inst.AreAllArgsImmediates()) {
-                inst.ReplaceUsesWith(IR::Value{inst.GetArg(0).GetU32() == 0});
-            }
-            break;
-        case Op::IsZero64:
-            if (inst.AreAllArgsImmediates()) {
-                inst.ReplaceUsesWith(IR::Value{inst.GetArg(0).GetU64() == 0});
-            }
-            break;
-        case Op::LogicalShiftLeft32:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, true, Safe::LogicalShiftLeft<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::LogicalShiftLeft64:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, false, Safe::LogicalShiftLeft<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::LogicalShiftRight32:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, true, Safe::LogicalShiftRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::LogicalShiftRight64:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, false, Safe::LogicalShiftRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::ArithmeticShiftRight32:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, true, Safe::ArithmeticShiftRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::ArithmeticShiftRight64:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, false, Safe::ArithmeticShiftRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::RotateRight32:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, true, Common::RotateRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::RotateRight64:
-            if (FoldShifts(inst)) {
-                ReplaceUsesWith(inst, false, Common::RotateRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU8()));
-            }
-            break;
-        case Op::LogicalShiftLeftMasked32:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, true, inst.GetArg(0).GetU32() << (inst.GetArg(1).GetU32() & 0x1f));
-            }
-            break;
-        case Op::LogicalShiftLeftMasked64:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, false, inst.GetArg(0).GetU64() << (inst.GetArg(1).GetU64() & 0x3f));
-            }
-            break;
-        case Op::LogicalShiftRightMasked32:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, true, inst.GetArg(0).GetU32() >> (inst.GetArg(1).GetU32() & 0x1f));
-            }
-            break;
-        case Op::LogicalShiftRightMasked64:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, false, inst.GetArg(0).GetU64() >> (inst.GetArg(1).GetU64() & 0x3f));
-            }
-            break;
-        case Op::ArithmeticShiftRightMasked32:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, true, static_cast<s32>(inst.GetArg(0).GetU32()) >> (inst.GetArg(1).GetU32() & 0x1f));
-            }
-            break;
-        case Op::ArithmeticShiftRightMasked64:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, false, static_cast<s64>(inst.GetArg(0).GetU64()) >> (inst.GetArg(1).GetU64() & 0x3f));
-            }
-            break;
-        case Op::RotateRightMasked32:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, true, Common::RotateRight<u32>(inst.GetArg(0).GetU32(), inst.GetArg(1).GetU32()));
-            }
-            break;
-        case Op::RotateRightMasked64:
-            if (inst.AreAllArgsImmediates()) {
-                ReplaceUsesWith(inst, false, Common::RotateRight<u64>(inst.GetArg(0).GetU64(), inst.GetArg(1).GetU64()));
-            }
-            break;
-        case Op::Add32:
-        case Op::Add64:
-            FoldAdd(inst, opcode == Op::Add32);
-            break;
-        case Op::Sub32:
-        case Op::Sub64:
-            FoldSub(inst, opcode == Op::Sub32);
-            break;
-        case Op::Mul32:
-        case Op::Mul64:
-            FoldMultiply(inst, opcode == Op::Mul32);
-            break;
-        case Op::SignedDiv32:
-        case Op::SignedDiv64:
-            FoldDivide(inst, opcode == Op::SignedDiv32, true);
-            break;
-        case Op::UnsignedDiv32:
-        case Op::UnsignedDiv64:
-            FoldDivide(inst, opcode == Op::UnsignedDiv32, false);
-            break;
-        case Op::And32:
-        case Op::And64:
-            FoldAND(inst, opcode == Op::And32);
-            break;
-        case Op::Eor32:
-        case Op::Eor64:
-            FoldEOR(inst, opcode == Op::Eor32);
-            break;
-        case Op::Or32:
-        case Op::Or64:
-            FoldOR(inst, opcode == Op::Or32);
-            break;
-        case Op::Not32:
-        case Op::Not64:
-            FoldNOT(inst, opcode == Op::Not32);
-            break;
-        case Op::SignExtendByteToWord:
-        case Op::SignExtendHalfToWord:
-            FoldSignExtendXToWord(inst);
-            break;
-        case Op::SignExtendByteToLong:
-        case Op::SignExtendHalfToLong:
-        case Op::SignExtendWordToLong:
-            FoldSignExtendXToLong(inst);
-            break;
-        case Op::ZeroExtendByteToWord:
-        case Op::ZeroExtendHalfToWord:
-            FoldZeroExtendXToWord(inst);
-            break;
-        case Op::ZeroExtendByteToLong:
-        case Op::ZeroExtendHalfToLong:
-        case Op::ZeroExtendWordToLong:
-            FoldZeroExtendXToLong(inst);
-            break;
-        case Op::ByteReverseWord:
-        case Op::ByteReverseHalf:
-        case Op::ByteReverseDual:
-            FoldByteReverse(inst, opcode);
-            break;
-        default:
-            break;
+        FoldInstruction(inst);
+    }
+}
+
+void SimplificationPass(IR::Block& block) {
+    // Instructions are in SSA form and every argument is defined before its use,
+    // so a single forward sweep sees the final form of all arguments of an instruction
+    // by the time it is folded. Unused pseudo-operations are dropped before folding as
+    // their presence inhibits some folds.
+    std::vector<IR::Inst*> candidates;
+    for (auto& inst : block) {
+        SkipIdentities(inst);
+        inst.InvalidateUnusedPseudoOperations();
+        FoldInstruction(inst);
+
+        if (!inst.MayHaveSideEffects()) {
+            candidates.push_back(&inst);
+        }
+    }
+
+    // Only instructions that cannot have side-effects are revisited. Removing an instruction
+    // can only make earlier instructions dead, so these are visited in reverse order.
+    for (IR::Inst* inst : Common::Reverse(candidates)) {
+        if (IsRemovable(*inst)) {
+            inst->Invalidate();
+            block.Instructions().remove(inst);
         }
     }
 }
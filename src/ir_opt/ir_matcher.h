@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#pragma once
+
 #include <optional>
 #include <tuple>
 
@@ -42,6 +44,8 @@ struct CaptureUImm {
     using ReturnType = std::tuple<u64>;
 
     static std::optional<ReturnType> Match(IR::Value value) {
+        if (!value.IsImmediate())
+            return std::nullopt;
         return std::tuple(value.GetImmediateAsU64());
     }
 };
@@ -50,6 +54,8 @@ struct CaptureSImm {
     using ReturnType = std::tuple<s64>;
 
     static std::optional<ReturnType> Match(IR::Value value) {
+        if (!value.IsImmediate())
+            return std::nullopt;
         return std::tuple(value.GetImmediateAsS64());
     }
 };
@@ -59,7 +65,7 @@ struct UImm {
     using ReturnType = std::tuple<>;
 
     static std::optional<std::tuple<>> Match(IR::Value value) {
-        if (value.GetImmediateAsU64() == Value)
+        if (value.IsUnsignedImmediate(Value))
             return std::tuple();
         return std::nullopt;
     }
@@ -70,7 +76,7 @@ struct SImm {
     using ReturnType = std::tuple<>;
 
     static std::optional<std::tuple<>> Match(IR::Value value) {
-        if (value.GetImmediateAsS64() == Value)
+        if (value.IsSignedImmediate(Value))
             return std::tuple();
         return std::nullopt;
     }
@@ -0,0 +1,62 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include "common/common_types.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+
+namespace Dynarmic::Optimization {
+
+/// A guest address of the form (base + offset). base is nullptr for constant addresses.
+struct MemoryAddress {
+    IR::Inst* base;
+    u64 offset;
+};
+
+/// Splits a guest address into a base and a constant offset by looking through
+/// additions and subtractions of immediates.
+template <IR::Opcode add_op, IR::Opcode sub_op, u64 address_mask>
+MemoryAddress DecomposeMemoryAddress(IR::Value value) {
+    u64 offset = 0;
+
+    while (!value.IsImmediate()) {
+        IR::Inst* const inst = value.GetInstRecursive();
+        if (inst->GetOpcode() == add_op && inst->GetArg(2).IsImmediate() && !inst->GetArg(2).GetU1()) {
+            if (inst->GetArg(1).IsImmediate()) {
+                offset += inst->GetArg(1).GetImmediateAsU64();
+                value = inst->GetArg(0);
+                continue;
+            }
+            if (inst->GetArg(0).IsImmediate()) {
+                offset += inst->GetArg(0).GetImmediateAsU64();
+                value = inst->GetArg(1);
+                continue;
+            }
+        }
+        if (inst->GetOpcode() == sub_op && inst->GetArg(2).IsImmediate() && inst->GetArg(2).GetU1() && inst->GetArg(1).IsImmediate()) {
+            offset -= inst->GetArg(1).GetImmediateAsU64();
+            value = inst->GetArg(0);
+            continue;
+        }
+        return {inst, offset & address_mask};
+    }
+
+    return {nullptr, (value.GetImmediateAsU64() + offset) & address_mask};
+}
+
+/// Memory accesses cannot be moved across instructions that may observe or alter guest memory.
+inline bool IsMemoryOrderingBoundary(const IR::Inst& inst) {
+    return inst.IsMemoryReadOrWrite()
+        || inst.IsBarrier()
+        || inst.CausesCPUException()
+        || inst.AltersExclusiveState()
+        || inst.IsCoprocessorInstruction()
+        || inst.GetOpcode() == IR::Opcode::A64DataCacheOperationRaised;
+}
+
+} // namespace Dynarmic::Optimization
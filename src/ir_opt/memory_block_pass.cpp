@@ -0,0 +1,202 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <vector>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/memory_address.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+namespace {
+
+using Op = IR::Opcode;
+
+// Size of the memory block buffer in the jit state.
+constexpr size_t max_block_length = 64;
+
+struct A32Traits {
+    static constexpr Op add = Op::Add32;
+    static constexpr Op sub = Op::Sub32;
+    static constexpr u64 address_mask = 0xFFFF'FFFFull;
+    static constexpr Op read_block = Op::A32ReadMemoryBlock;
+    static constexpr Op write_block = Op::A32WriteMemoryBlock;
+
+    static size_t ReadSize(Op op) {
+        switch (op) {
+        case Op::A32ReadMemory32:
+            return 4;
+        case Op::A32ReadMemory64:
+            return 8;
+        case Op::A32ReadMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    static size_t WriteSize(Op op) {
+        switch (op) {
+        case Op::A32WriteMemory32:
+            return 4;
+        case Op::A32WriteMemory64:
+            return 8;
+        case Op::A32WriteMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+};
+
+struct A64Traits {
+    static constexpr Op add = Op::Add64;
+    static constexpr Op sub = Op::Sub64;
+    static constexpr u64 address_mask = 0xFFFF'FFFF'FFFF'FFFFull;
+    static constexpr Op read_block = Op::A64ReadMemoryBlock;
+    static constexpr Op write_block = Op::A64WriteMemoryBlock;
+
+    static size_t ReadSize(Op op) {
+        switch (op) {
+        case Op::A64ReadMemory32:
+            return 4;
+        case Op::A64ReadMemory64:
+            return 8;
+        case Op::A64ReadMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    static size_t WriteSize(Op op) {
+        switch (op) {
+        case Op::A64WriteMemory32:
+            return 4;
+        case Op::A64WriteMemory64:
+            return 8;
+        case Op::A64WriteMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+};
+
+Op GetMemoryBlockOp(size_t size) {
+    switch (size) {
+    case 4:
+        return Op::GetMemoryBlock32;
+    case 8:
+        return Op::GetMemoryBlock64;
+    case 16:
+        return Op::GetMemoryBlock128;
+    }
+    UNREACHABLE();
+}
+
+Op SetMemoryBlockOp(size_t size) {
+    switch (size) {
+    case 4:
+        return Op::SetMemoryBlock32;
+    case 8:
+        return Op::SetMemoryBlock64;
+    case 16:
+        return Op::SetMemoryBlock128;
+    }
+    UNREACHABLE();
+}
+
+struct Group {
+    std::vector<IR::Block::iterator> accesses;
+    std::vector<size_t> sizes;
+    bool is_write = false;
+    MemoryAddress start{};
+    size_t length = 0;
+};
+
+template <typename Traits>
+void LowerGroup(IR::Block& block, const Group& group) {
+    const IR::Value start_address = group.accesses.front()->GetArg(0);
+    const IR::Value length{static_cast<u8>(group.length)};
+
+    if (group.is_write) {
+        block.PrependNewInst(std::next(group.accesses.back()), Traits::write_block, {start_address, length});
+    } else {
+        block.PrependNewInst(group.accesses.front(), Traits::read_block, {start_address, length});
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < group.accesses.size(); i++) {
+        IR::Inst& inst = *group.accesses[i];
+        inst.ReplaceOpcode(group.is_write ? SetMemoryBlockOp(group.sizes[i]) : GetMemoryBlockOp(group.sizes[i]));
+        inst.SetArg(0, IR::Value{static_cast<u8>(offset)});
+        offset += group.sizes[i];
+    }
+}
+
+template <typename Traits>
+void MemoryBlockPass(IR::Block& block) {
+    Group group;
+
+    const auto flush = [&] {
+        if (group.accesses.size() >= 2) {
+            LowerGroup<Traits>(block, group);
+        }
+        group = {};
+    };
+
+    for (auto iter = block.begin(); iter != block.end(); ++iter) {
+        const size_t read_size = Traits::ReadSize(iter->GetOpcode());
+        const size_t write_size = Traits::WriteSize(iter->GetOpcode());
+
+        if (read_size == 0 && write_size == 0) {
+            if (IsMemoryOrderingBoundary(*iter)) {
+                flush();
+            }
+            continue;
+        }
+
+        const bool is_write = write_size != 0;
+        const size_t size = is_write ? write_size : read_size;
+        const MemoryAddress address = DecomposeMemoryAddress<Traits::add, Traits::sub, Traits::address_mask>(iter->GetArg(0));
+
+        const bool extends_group = !group.accesses.empty()
+                                && group.is_write == is_write
+                                && group.start.base == address.base
+                                && ((group.start.offset + group.length) & Traits::address_mask) == address.offset
+                                && group.length + size <= max_block_length;
+
+        if (!extends_group) {
+            flush();
+            group.is_write = is_write;
+            group.start = address;
+        }
+
+        group.accesses.push_back(iter);
+        group.sizes.push_back(size);
+        group.length += size;
+    }
+
+    flush();
+}
+
+} // anonymous namespace
+
+void A32MemoryBlockPass(IR::Block& block) {
+    MemoryBlockPass<A32Traits>(block);
+}
+
+void A64MemoryBlockPass(IR::Block& block) {
+    MemoryBlockPass<A64Traits>(block);
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,204 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <optional>
+
+#include <dynarmic/A64/config.h>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/memory_address.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+namespace {
+
+using Op = IR::Opcode;
+
+constexpr u64 page_size = 4096;
+
+struct A32Traits {
+    static constexpr Op add = Op::Add32;
+    static constexpr Op sub = Op::Sub32;
+    static constexpr u64 address_mask = 0xFFFF'FFFFull;
+
+    static std::optional<Op> ReadOp(size_t size) {
+        switch (size) {
+        case 4:
+            return Op::A32ReadMemory32;
+        case 8:
+            return Op::A32ReadMemory64;
+        case 16:
+            return Op::A32ReadMemory128;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    static std::optional<Op> WriteOp(size_t size) {
+        switch (size) {
+        case 4:
+            return Op::A32WriteMemory32;
+        case 8:
+            return Op::A32WriteMemory64;
+        case 16:
+            return Op::A32WriteMemory128;
+        default:
+            return std::nullopt;
+        }
+    }
+};
+
+struct A64Traits {
+    static constexpr Op add = Op::Add64;
+    static constexpr Op sub = Op::Sub64;
+    static constexpr u64 address_mask = 0xFFFF'FFFF'FFFF'FFFFull;
+
+    static std::optional<Op> ReadOp(size_t size) {
+        switch (size) {
+        case 4:
+            return Op::A64ReadMemory32;
+        case 8:
+            return Op::A64ReadMemory64;
+        case 16:
+            return Op::A64ReadMemory128;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    static std::optional<Op> WriteOp(size_t size) {
+        switch (size) {
+        case 4:
+            return Op::A64WriteMemory32;
+        case 8:
+            return Op::A64WriteMemory64;
+        case 16:
+            return Op::A64WriteMemory128;
+        default:
+            return std::nullopt;
+        }
+    }
+};
+
+struct Access {
+    IR::Block::iterator inst;
+    bool is_write;
+    MemoryAddress address;
+};
+
+// Read(a, size) ; Read(a + size, size) -> Read(a, 2 * size), split into halves
+//
+// The wide read takes the place of the first read.
+//
+template <typename Traits>
+void MergeReads(IR::Block& block, IR::Block::iterator first, IR::Block::iterator second, size_t size) {
+    const auto wide = block.PrependNewInst(first, *Traits::ReadOp(2 * size), {first->GetArg(0)});
+    const IR::Value wide_value{&*wide};
+
+    IR::Block::iterator lower, upper;
+    if (size == 4) {
+        lower = block.PrependNewInst(first, Op::LeastSignificantWord, {wide_value});
+        upper = block.PrependNewInst(first, Op::MostSignificantWord, {wide_value});
+    } else {
+        lower = block.PrependNewInst(first, Op::VectorGetElement64, {wide_value, IR::Value{u8(0)}});
+        upper = block.PrependNewInst(first, Op::VectorGetElement64, {wide_value, IR::Value{u8(1)}});
+    }
+
+    first->ReplaceUsesWith(IR::Value{&*lower});
+    second->ReplaceUsesWith(IR::Value{&*upper});
+}
+
+// Write(a, x, size) ; Write(a + size, y, size) -> Write(a, Pack(x, y), 2 * size)
+//
+// The wide write takes the place of the second write, where both values are available.
+//
+template <typename Traits>
+void MergeWrites(IR::Block& block, IR::Block::iterator first, IR::Block::iterator second, size_t size) {
+    const Op pack_op = size == 4 ? Op::Pack2x32To1x64 : Op::Pack2x64To1x128;
+    const auto packed = block.PrependNewInst(second, pack_op, {first->GetArg(1), second->GetArg(1)});
+    block.PrependNewInst(second, *Traits::WriteOp(2 * size), {first->GetArg(0), IR::Value{&*packed}});
+
+    first->Invalidate();
+    second->Invalidate();
+}
+
+// Merges pairs of adjacent accesses of the given size. Each access is merged at most once per sweep,
+// so that runs of accesses are paired up from the lowest address.
+template <typename Traits>
+void CoalesceAccesses(IR::Block& block, size_t size) {
+    bool has_pending = false;
+    Access pending{};
+
+    for (auto iter = block.begin(); iter != block.end(); ++iter) {
+        const bool is_read = iter->GetOpcode() == Traits::ReadOp(size);
+        const bool is_write = iter->GetOpcode() == Traits::WriteOp(size);
+
+        if (!is_read && !is_write) {
+            if (IsMemoryOrderingBoundary(*iter)) {
+                has_pending = false;
+            }
+            continue;
+        }
+
+        const MemoryAddress address = DecomposeMemoryAddress<Traits::add, Traits::sub, Traits::address_mask>(iter->GetArg(0));
+
+        const bool is_adjacent = has_pending
+                              && pending.is_write == is_write
+                              && pending.address.base == address.base
+                              && ((pending.address.offset + size) & Traits::address_mask) == address.offset;
+
+        // Constant addresses that would straddle a page boundary once merged are left split.
+        const bool crosses_page = is_adjacent && !address.base && (pending.address.offset % page_size) + 2 * size > page_size;
+
+        if (!is_adjacent || crosses_page) {
+            has_pending = true;
+            pending = Access{iter, is_write, address};
+            continue;
+        }
+
+        if (is_write) {
+            MergeWrites<Traits>(block, pending.inst, iter, size);
+        } else {
+            MergeReads<Traits>(block, pending.inst, iter, size);
+        }
+        has_pending = false;
+    }
+}
+
+// A wide access that straddles a page boundary must be sent to the memory callbacks as a whole,
+// rather than through a single host page pointer.
+bool StraddlingAccessFallsBack(const A64::UserConfig& conf, size_t bitsize) {
+    if (!conf.page_table || conf.enable_software_tlb) {
+        return true;
+    }
+    // Misaligned accesses that do not straddle a page must stay on the fast path, as the
+    // accesses they were merged from may well have been aligned.
+    return (conf.detect_misaligned_access_via_page_table & bitsize) != 0
+        && conf.only_detect_misalignment_via_page_table_on_page_boundary;
+}
+
+} // anonymous namespace
+
+void A32MemoryCoalescingPass(IR::Block& block) {
+    // The A32 backend sends accesses that straddle a page boundary to the memory callbacks itself.
+    CoalesceAccesses<A32Traits>(block, 4);
+    CoalesceAccesses<A32Traits>(block, 8);
+}
+
+void A64MemoryCoalescingPass(IR::Block& block, const A64::UserConfig& conf) {
+    if (StraddlingAccessFallsBack(conf, 64)) {
+        CoalesceAccesses<A64Traits>(block, 4);
+    }
+    if (StraddlingAccessFallsBack(conf, 128)) {
+        CoalesceAccesses<A64Traits>(block, 8);
+    }
+}
+
+} // namespace Dynarmic::Optimization
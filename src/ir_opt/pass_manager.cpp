@@ -0,0 +1,143 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <chrono>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "ir_opt/pass_manager.h"
+
+namespace Dynarmic::Optimization {
+
+namespace {
+
+/// Number of instructions in block, excluding those that have been invalidated but not yet removed.
+u64 CountInstructions(const IR::Block& block) {
+    u64 count = 0;
+    for (const auto& inst : block) {
+        if (inst.GetOpcode() != IR::Opcode::Void) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // anonymous namespace
+
+std::vector<OptimizationPass> GetPipeline(OptimizationLevel level, const std::vector<OptimizationPass>& explicit_passes) {
+    if (!explicit_passes.empty()) {
+        return explicit_passes;
+    }
+
+    switch (level) {
+    case OptimizationLevel::None:
+        return {};
+    case OptimizationLevel::Fast:
+        return {
+            OptimizationPass::GetSetElimination,
+            OptimizationPass::DeadCodeElimination,
+        };
+    case OptimizationLevel::Full:
+        return {
+            OptimizationPass::GetSetElimination,
+            OptimizationPass::ConstantMemoryReads,
+            OptimizationPass::MemoryCoalescing,
+            OptimizationPass::Simplification,
+            OptimizationPass::Peephole,
+            OptimizationPass::Simplification,
+            OptimizationPass::MergeInterpretBlocks,
+        };
+    }
+    ASSERT_FALSE("Invalid OptimizationLevel");
+}
+
+const char* GetPassName(OptimizationPass pass) {
+    switch (pass) {
+    case OptimizationPass::GetSetElimination:
+        return "GetSetElimination";
+    case OptimizationPass::ConstantMemoryReads:
+        return "ConstantMemoryReads";
+    case OptimizationPass::ConstantPropagation:
+        return "ConstantPropagation";
+    case OptimizationPass::Peephole:
+        return "Peephole";
+    case OptimizationPass::DeadCodeElimination:
+        return "DeadCodeElimination";
+    case OptimizationPass::MergeInterpretBlocks:
+        return "MergeInterpretBlocks";
+    case OptimizationPass::Simplification:
+        return "Simplification";
+    case OptimizationPass::MemoryCoalescing:
+        return "MemoryCoalescing";
+    case OptimizationPass::RedundantLoadElimination:
+        return "RedundantLoadElimination";
+    }
+    ASSERT_FALSE("Invalid OptimizationPass");
+}
+
+PassManager::PassManager(std::vector<OptimizationPass> pipeline_, bool record_statistics)
+        : pipeline(std::move(pipeline_)), record_statistics(record_statistics) {
+    for (const OptimizationPass pass : pipeline) {
+        ASSERT(static_cast<size_t>(pass) < OptimizationPassCount);
+        statistics.push_back(PassStatistics{pass, GetPassName(pass)});
+    }
+}
+
+void PassManager::Register(OptimizationPass pass, PassFunction function) {
+    functions[static_cast<size_t>(pass)] = std::move(function);
+}
+
+void PassManager::Run(IR::Block& block) {
+    if (!record_statistics) {
+        for (const OptimizationPass pass : pipeline) {
+            if (const auto& function = functions[static_cast<size_t>(pass)]) {
+                function(block);
+            }
+        }
+        return;
+    }
+
+    // The count after one pass is reused as the count before the next.
+    u64 instruction_count = CountInstructions(block);
+
+    for (size_t i = 0; i < pipeline.size(); i++) {
+        const auto& function = functions[static_cast<size_t>(pipeline[i])];
+        if (!function) {
+            continue;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        function(block);
+        const auto end = std::chrono::steady_clock::now();
+
+        PassStatistics& stats = statistics[i];
+        stats.invocations++;
+        stats.total_time_ns += static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        stats.instructions_before += instruction_count;
+        instruction_count = CountInstructions(block);
+        stats.instructions_after += instruction_count;
+    }
+}
+
+std::vector<PassStatistics> PassManager::GetStatistics() const {
+    std::vector<PassStatistics> result;
+    for (size_t i = 0; i < pipeline.size(); i++) {
+        if (functions[static_cast<size_t>(pipeline[i])]) {
+            result.push_back(statistics[i]);
+        }
+    }
+    return result;
+}
+
+void PassManager::ResetStatistics() {
+    for (PassStatistics& stats : statistics) {
+        stats = PassStatistics{stats.pass, stats.name};
+    }
+}
+
+} // namespace Dynarmic::Optimization
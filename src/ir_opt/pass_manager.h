@@ -0,0 +1,55 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include <dynarmic/optimization.h>
+
+namespace Dynarmic::IR {
+class Block;
+}
+
+namespace Dynarmic::Optimization {
+
+/// Returns the pipeline selected by a level, or explicit_passes if it is non-empty.
+std::vector<OptimizationPass> GetPipeline(OptimizationLevel level, const std::vector<OptimizationPass>& explicit_passes);
+
+const char* GetPassName(OptimizationPass pass);
+
+/**
+ * Runs a configurable sequence of optimization passes over IR blocks.
+ *
+ * Each frontend/backend combination registers the implementations of the passes it supports.
+ * Passes in the pipeline that have no implementation registered are skipped.
+ */
+class PassManager final {
+public:
+    using PassFunction = std::function<void(IR::Block&)>;
+
+    PassManager(std::vector<OptimizationPass> pipeline, bool record_statistics);
+
+    /// Provides the implementation of pass.
+    void Register(OptimizationPass pass, PassFunction function);
+
+    /// Runs each registered pass of the pipeline over block, in order.
+    void Run(IR::Block& block);
+
+    /// Statistics for each registered pass of the pipeline, in pipeline order.
+    std::vector<PassStatistics> GetStatistics() const;
+    void ResetStatistics();
+
+private:
+    std::vector<OptimizationPass> pipeline;
+    std::array<PassFunction, OptimizationPassCount> functions;
+
+    bool record_statistics;
+    std::vector<PassStatistics> statistics;
+};
+
+} // namespace Dynarmic::Optimization
@@ -23,12 +23,21 @@ namespace Dynarmic::Optimization {
 void A32ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb);
 void A32GetSetElimination(IR::Block& block);
 void A32MergeInterpretBlocksPass(IR::Block& block, A32::UserCallbacks* cb);
+void A32RedundantLoadElimination(IR::Block& block, bool forward_writes);
+void A32MemoryBlockPass(IR::Block& block);
+void A32MemoryCoalescingPass(IR::Block& block);
 void A64CallbackConfigPass(IR::Block& block, const A64::UserConfig& conf);
+void A64ConstantMemoryReads(IR::Block& block, A64::UserCallbacks* cb);
 void A64GetSetElimination(IR::Block& block);
 void A64MergeInterpretBlocksPass(IR::Block& block, A64::UserCallbacks* cb);
+void A64RedundantLoadElimination(IR::Block& block, bool forward_writes);
+void A64MemoryBlockPass(IR::Block& block);
+void A64MemoryCoalescingPass(IR::Block& block, const A64::UserConfig& conf);
 void ConstantPropagation(IR::Block& block);
 void DeadCodeElimination(IR::Block& block);
 void IdentityRemovalPass(IR::Block& block);
+void PeepholePass(IR::Block& block);
+void SimplificationPass(IR::Block& block);
 void VerificationPass(const IR::Block& block);
 
 } // namespace Dynarmic::Optimization
@@ -0,0 +1,210 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <array>
+#include <vector>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/ir_matcher.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+using Op = Dynarmic::IR::Opcode;
+
+namespace {
+
+using namespace IRMatcher;
+
+// A rule attempts to rewrite a single instruction, returning true if it did so.
+// Rules only ever modify the instruction they are given; instructions that become
+// unused as a result are left for dead code elimination to clean up.
+using Rule = bool (*)(IR::Inst& inst);
+
+struct PeepholeRule {
+    Op opcode;
+    Rule rule;
+};
+
+// Add(x, LogicalShiftLeft(y, imm)) -> AddShiftedLeft(x, y, imm)
+//
+// The fused form maps onto LEA on x64 (for small shifts) and onto ADD (shifted register) on AArch64.
+//
+template <Op add_op, Op shift_op, Op fused_op, u64 bitsize>
+bool FuseAddShiftedLeft(IR::Inst& inst) {
+    using Shifted = IRMatcher::Inst<shift_op, CaptureValue, CaptureUImm>;
+
+    const auto rewrite = [&inst](IR::Value lhs, IR::Value operand, u64 shift) {
+        if (shift >= bitsize) {
+            return false;
+        }
+        inst.ReplaceOpcode(fused_op);
+        inst.SetArg(0, lhs);
+        inst.SetArg(1, operand);
+        inst.SetArg(2, IR::Value{static_cast<u8>(shift)});
+        return true;
+    };
+
+    if (const auto m = IRMatcher::Inst<add_op, CaptureValue, Shifted, UImm<0>>::Match(inst)) {
+        const auto [lhs, operand, shift] = *m;
+        return rewrite(lhs, operand, shift);
+    }
+    if (const auto m = IRMatcher::Inst<add_op, Shifted, CaptureValue, UImm<0>>::Match(inst)) {
+        const auto [operand, shift, rhs] = *m;
+        return rewrite(rhs, operand, shift);
+    }
+    return false;
+}
+
+// And(x, Not(y)) -> AndNot(x, y)
+// And(Not(x), y) -> AndNot(y, x)
+//
+// The fused form maps onto ANDN on x64 hosts with BMI1 and onto BIC on AArch64.
+//
+template <Op and_op, Op not_op, Op fused_op>
+bool FuseAndNot(IR::Inst& inst) {
+    using Inverted = IRMatcher::Inst<not_op, CaptureValue>;
+
+    const auto rewrite = [&inst](IR::Value lhs, IR::Value inverted) {
+        inst.ReplaceOpcode(fused_op);
+        inst.SetArg(0, lhs);
+        inst.SetArg(1, inverted);
+        return true;
+    };
+
+    if (const auto m = IRMatcher::Inst<and_op, CaptureValue, Inverted>::Match(inst)) {
+        const auto [lhs, inverted] = *m;
+        return rewrite(lhs, inverted);
+    }
+    if (const auto m = IRMatcher::Inst<and_op, Inverted, CaptureValue>::Match(inst)) {
+        const auto [inverted, rhs] = *m;
+        return rewrite(rhs, inverted);
+    }
+    return false;
+}
+
+// Extract(Extend(x)) -> x
+//
+// Applies whenever the extraction recovers exactly the bits that were extended.
+//
+template <Op extract_op, Op extend_op>
+bool FoldExtractOfExtend(IR::Inst& inst) {
+    if (const auto m = IRMatcher::Inst<extract_op, IRMatcher::Inst<extend_op, CaptureValue>>::Match(inst)) {
+        const auto [operand] = *m;
+        inst.ReplaceUsesWith(operand);
+        return true;
+    }
+    return false;
+}
+
+// Extract(Extend(x)) -> NarrowerExtend(x)
+//
+// e.g.: LeastSignificantWord(ZeroExtendHalfToLong(x)) -> ZeroExtendHalfToWord(x)
+//
+template <Op extract_op, Op extend_op, Op narrower_extend_op>
+bool NarrowExtractOfExtend(IR::Inst& inst) {
+    if (const auto m = IRMatcher::Inst<extract_op, IRMatcher::Inst<extend_op, CaptureValue>>::Match(inst)) {
+        const auto [operand] = *m;
+        inst.ReplaceOpcode(narrower_extend_op);
+        inst.SetArg(0, operand);
+        return true;
+    }
+    return false;
+}
+
+// LeastSignificantWord(Pack2x32To1x64(lo, hi)) -> lo
+// MostSignificantWord(Pack2x32To1x64(lo, hi)) -> hi
+//
+template <Op extract_op, size_t half>
+bool FoldExtractOfPack64(IR::Inst& inst) {
+    if (const auto m = IRMatcher::Inst<extract_op, IRMatcher::Inst<Op::Pack2x32To1x64, CaptureValue, CaptureValue>>::Match(inst)) {
+        inst.ReplaceUsesWith(std::get<half>(*m));
+        return true;
+    }
+    return false;
+}
+
+// VectorGetElement64(Pack2x64To1x128(lo, hi), 0) -> lo
+// VectorGetElement64(Pack2x64To1x128(lo, hi), 1) -> hi
+// VectorGetElement64(ZeroExtendLongToQuad(x), 0) -> x
+// VectorGetElement64(ZeroExtendLongToQuad(x), 1) -> 0
+//
+bool FoldVectorGetElement64(IR::Inst& inst) {
+    if (const auto m = IRMatcher::Inst<Op::VectorGetElement64, IRMatcher::Inst<Op::Pack2x64To1x128, CaptureValue, CaptureValue>, CaptureUImm>::Match(inst)) {
+        const auto [lo, hi, index] = *m;
+        inst.ReplaceUsesWith(index == 0 ? lo : hi);
+        return true;
+    }
+    if (const auto m = IRMatcher::Inst<Op::VectorGetElement64, IRMatcher::Inst<Op::ZeroExtendLongToQuad, CaptureValue>, CaptureUImm>::Match(inst)) {
+        const auto [operand, index] = *m;
+        inst.ReplaceUsesWith(index == 0 ? operand : IR::Value{u64(0)});
+        return true;
+    }
+    return false;
+}
+
+// Pack2x64To1x128(VectorGetElement64(v, 0), VectorGetElement64(v, 1)) -> v
+//
+bool FoldPackOfUnpack128(IR::Inst& inst) {
+    using Lower = IRMatcher::Inst<Op::VectorGetElement64, CaptureInst, UImm<0>>;
+    using Upper = IRMatcher::Inst<Op::VectorGetElement64, CaptureInst, UImm<1>>;
+
+    if (const auto m = IRMatcher::Inst<Op::Pack2x64To1x128, Lower, Upper>::Match(inst); m && IsSameInst(*m)) {
+        inst.ReplaceUsesWith(IR::Value{std::get<0>(*m)});
+        return true;
+    }
+    return false;
+}
+
+constexpr std::array peephole_rules {
+    PeepholeRule{Op::Add32, &FuseAddShiftedLeft<Op::Add32, Op::LogicalShiftLeft32, Op::AddShiftedLeft32, 32>},
+    PeepholeRule{Op::Add64, &FuseAddShiftedLeft<Op::Add64, Op::LogicalShiftLeft64, Op::AddShiftedLeft64, 64>},
+
+    PeepholeRule{Op::And32, &FuseAndNot<Op::And32, Op::Not32, Op::AndNot32>},
+    PeepholeRule{Op::And64, &FuseAndNot<Op::And64, Op::Not64, Op::AndNot64>},
+
+    PeepholeRule{Op::LeastSignificantWord, &FoldExtractOfExtend<Op::LeastSignificantWord, Op::ZeroExtendWordToLong>},
+    PeepholeRule{Op::LeastSignificantWord, &FoldExtractOfExtend<Op::LeastSignificantWord, Op::SignExtendWordToLong>},
+    PeepholeRule{Op::LeastSignificantWord, &NarrowExtractOfExtend<Op::LeastSignificantWord, Op::ZeroExtendHalfToLong, Op::ZeroExtendHalfToWord>},
+    PeepholeRule{Op::LeastSignificantWord, &NarrowExtractOfExtend<Op::LeastSignificantWord, Op::SignExtendHalfToLong, Op::SignExtendHalfToWord>},
+    PeepholeRule{Op::LeastSignificantWord, &NarrowExtractOfExtend<Op::LeastSignificantWord, Op::ZeroExtendByteToLong, Op::ZeroExtendByteToWord>},
+    PeepholeRule{Op::LeastSignificantWord, &NarrowExtractOfExtend<Op::LeastSignificantWord, Op::SignExtendByteToLong, Op::SignExtendByteToWord>},
+    PeepholeRule{Op::LeastSignificantWord, &FoldExtractOfPack64<Op::LeastSignificantWord, 0>},
+    PeepholeRule{Op::MostSignificantWord, &FoldExtractOfPack64<Op::MostSignificantWord, 1>},
+    PeepholeRule{Op::LeastSignificantHalf, &FoldExtractOfExtend<Op::LeastSignificantHalf, Op::ZeroExtendHalfToWord>},
+    PeepholeRule{Op::LeastSignificantHalf, &FoldExtractOfExtend<Op::LeastSignificantHalf, Op::SignExtendHalfToWord>},
+    PeepholeRule{Op::LeastSignificantByte, &FoldExtractOfExtend<Op::LeastSignificantByte, Op::ZeroExtendByteToWord>},
+    PeepholeRule{Op::LeastSignificantByte, &FoldExtractOfExtend<Op::LeastSignificantByte, Op::SignExtendByteToWord>},
+
+    PeepholeRule{Op::VectorGetElement64, &FoldVectorGetElement64},
+    PeepholeRule{Op::Pack2x64To1x128, &FoldPackOfUnpack128},
+};
+
+// Rules indexed by the opcode of the instruction they apply to.
+const auto peephole_lookup = []{
+    std::array<std::vector<Rule>, IR::OpcodeCount> result;
+    for (const auto& [opcode, rule] : peephole_rules) {
+        result[static_cast<size_t>(opcode)].push_back(rule);
+    }
+    return result;
+}();
+
+} // Anonymous namespace
+
+void PeepholePass(IR::Block& block) {
+    for (auto& inst : block) {
+        for (const Rule rule : peephole_lookup[static_cast<size_t>(inst.GetOpcode())]) {
+            if (rule(inst)) {
+                break;
+            }
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,169 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/memory_address.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+namespace {
+
+using Op = IR::Opcode;
+
+struct A32Traits {
+    static constexpr Op add = Op::Add32;
+    static constexpr Op sub = Op::Sub32;
+    static constexpr u64 address_mask = 0xFFFF'FFFFull;
+
+    static size_t ReadSize(Op op) {
+        switch (op) {
+        case Op::A32ReadMemory8:
+            return 1;
+        case Op::A32ReadMemory16:
+            return 2;
+        case Op::A32ReadMemory32:
+            return 4;
+        case Op::A32ReadMemory64:
+            return 8;
+        case Op::A32ReadMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    static size_t WriteSize(Op op) {
+        switch (op) {
+        case Op::A32WriteMemory8:
+            return 1;
+        case Op::A32WriteMemory16:
+            return 2;
+        case Op::A32WriteMemory32:
+            return 4;
+        case Op::A32WriteMemory64:
+            return 8;
+        case Op::A32WriteMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+};
+
+struct A64Traits {
+    static constexpr Op add = Op::Add64;
+    static constexpr Op sub = Op::Sub64;
+    static constexpr u64 address_mask = 0xFFFF'FFFF'FFFF'FFFFull;
+
+    static size_t ReadSize(Op op) {
+        switch (op) {
+        case Op::A64ReadMemory8:
+            return 1;
+        case Op::A64ReadMemory16:
+            return 2;
+        case Op::A64ReadMemory32:
+            return 4;
+        case Op::A64ReadMemory64:
+            return 8;
+        case Op::A64ReadMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    static size_t WriteSize(Op op) {
+        switch (op) {
+        case Op::A64WriteMemory8:
+            return 1;
+        case Op::A64WriteMemory16:
+            return 2;
+        case Op::A64WriteMemory32:
+            return 4;
+        case Op::A64WriteMemory64:
+            return 8;
+        case Op::A64WriteMemory128:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+};
+
+// The contents of guest memory at address, as of the current point in the block.
+struct KnownValue {
+    MemoryAddress address;
+    size_t size;
+    IR::Value value;
+};
+
+template <typename Traits>
+bool MayOverlap(const KnownValue& known, const MemoryAddress& address, size_t size) {
+    if (known.address.base != address.base) {
+        return true;
+    }
+    const u64 distance = (address.offset - known.address.offset) & Traits::address_mask;
+    const u64 reverse_distance = (known.address.offset - address.offset) & Traits::address_mask;
+    return distance < known.size || reverse_distance < size;
+}
+
+template <typename Traits>
+void RedundantLoadElimination(IR::Block& block, bool forward_writes) {
+    std::vector<KnownValue> known_values;
+
+    for (auto& inst : block) {
+        const size_t read_size = Traits::ReadSize(inst.GetOpcode());
+        const size_t write_size = Traits::WriteSize(inst.GetOpcode());
+
+        if (read_size == 0 && write_size == 0) {
+            if (IsMemoryOrderingBoundary(inst)) {
+                known_values.clear();
+            }
+            continue;
+        }
+
+        const MemoryAddress address = DecomposeMemoryAddress<Traits::add, Traits::sub, Traits::address_mask>(inst.GetArg(0));
+
+        if (read_size != 0) {
+            const auto iter = std::find_if(known_values.begin(), known_values.end(), [&](const KnownValue& known) {
+                return known.address.base == address.base && known.address.offset == address.offset && known.size == read_size;
+            });
+            if (iter != known_values.end()) {
+                inst.ReplaceUsesWith(iter->value);
+            } else {
+                known_values.push_back({address, read_size, IR::Value{&inst}});
+            }
+            continue;
+        }
+
+        // Only accesses that are known not to alias the write survive it.
+        known_values.erase(std::remove_if(known_values.begin(), known_values.end(), [&](const KnownValue& known) {
+            return MayOverlap<Traits>(known, address, write_size);
+        }), known_values.end());
+        if (forward_writes) {
+            known_values.push_back({address, write_size, inst.GetArg(1)});
+        }
+    }
+}
+
+} // anonymous namespace
+
+void A32RedundantLoadElimination(IR::Block& block, bool forward_writes) {
+    RedundantLoadElimination<A32Traits>(block, forward_writes);
+}
+
+void A64RedundantLoadElimination(IR::Block& block, bool forward_writes) {
+    RedundantLoadElimination<A64Traits>(block, forward_writes);
+}
+
+} // namespace Dynarmic::Optimization
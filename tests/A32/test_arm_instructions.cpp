@@ -3,6 +3,10 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+#include <cstdint>
+#include <memory>
+
 #include <catch.hpp>
 #include <dynarmic/A32/a32.h>
 
@@ -497,3 +501,175 @@ TEST_CASE("arm: Cleared Q flag 2", "[arm][A32][JitA64]") {
 
     REQUIRE((jit.Cpsr() & (1 << 27)) == 0);
 }
+
+TEST_CASE("arm: Page table memory accesses", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::UserConfig config = GetUserConfig(&test_env);
+
+    // Only the page at 0x1000 is backed by host memory, everything else goes through the callbacks.
+    std::array<u8, 4096> page;
+    for (size_t i = 0; i < page.size(); i++) {
+        page[i] = static_cast<u8>(i);
+    }
+    auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    page_table->fill(nullptr);
+    (*page_table)[1] = page.data();
+    config.page_table = page_table.get();
+
+    A32::Jit jit{config};
+    test_env.code_mem = {
+        0xf42002cf, // vld1.64 {d0-d3}, [r0]
+        0xf40102cf, // vst1.64 {d0-d3}, [r1]
+        0xf422460d, // vld1.8 {d4-d6}, [r2]!
+        0xe1904f9f, // ldrex r4, [r0]
+        0xe2844001, // add r4, r4, #1
+        0xe1805f94, // strex r5, r4, [r0]
+        0xe1b16f9f, // ldrexd r6, r7, [r1]
+        0xe2866001, // add r6, r6, #1
+        0xe1a18f96, // strexd r8, r6, r7, [r1]
+        0xeafffffe, // b +#0 (infinite loop)
+    };
+
+    jit.Regs() = {};
+    jit.Regs()[0] = 0x1000;
+    jit.Regs()[1] = 0x2000;
+    jit.Regs()[2] = 0x3010;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 10;
+    jit.Run();
+
+    REQUIRE(jit.ExtRegs()[0] == 0x03020100);
+    REQUIRE(jit.ExtRegs()[1] == 0x07060504);
+    REQUIRE(jit.ExtRegs()[6] == 0x1B1A1918);
+    REQUIRE(jit.ExtRegs()[7] == 0x1F1E1D1C);
+    REQUIRE(jit.ExtRegs()[8] == 0x13121110);
+    REQUIRE(jit.ExtRegs()[11] == 0x1F1E1D1C);
+    REQUIRE(jit.ExtRegs()[12] == 0x23222120);
+    REQUIRE(jit.ExtRegs()[13] == 0x27262524);
+    REQUIRE(jit.Regs()[2] == 0x3028);
+    REQUIRE(jit.Regs()[4] == 0x03020101);
+    REQUIRE(jit.Regs()[5] == 0);
+    REQUIRE(jit.Regs()[6] == 0x03020101);
+    REQUIRE(jit.Regs()[7] == 0x07060504);
+    REQUIRE(jit.Regs()[8] == 0);
+    REQUIRE(page[0] == 0x01);
+    REQUIRE(test_env.MemoryRead64(0x2000) == 0x0706050403020101);
+    REQUIRE(test_env.MemoryRead64(0x2018) == 0x1F1E1D1C1B1A1918);
+}
+
+TEST_CASE("arm: Page table attribute bits", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::UserConfig config = GetUserConfig(&test_env);
+
+    std::array<u32, 1024> watched_page{}, page{};
+    auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    page_table->fill(nullptr);
+    (*page_table)[0x10] = reinterpret_cast<u8*>(reinterpret_cast<std::uintptr_t>(watched_page.data()) | A32::UserConfig::PAGE_ATTRIBUTE_WRITE_CALLBACK);
+    (*page_table)[0x11] = reinterpret_cast<u8*>(page.data());
+    config.page_table = page_table.get();
+    config.page_table_attribute_bits = true;
+
+    A32::Jit jit{config};
+    test_env.code_mem = {
+        0xe5901000, // ldr r1, [r0]
+        0xe5802004, // str r2, [r0, #4]
+        0xe5903004, // ldr r3, [r0, #4]
+        0xe5842000, // str r2, [r4]
+        0xeafffffe, // b +#0 (infinite loop)
+    };
+
+    watched_page[0] = 0x01234567;
+    watched_page[1] = 0x89abcdef;
+
+    jit.Regs() = {};
+    jit.Regs()[0] = 0x10000;
+    jit.Regs()[2] = 0xfedcba98;
+    jit.Regs()[4] = 0x11000;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 5;
+    jit.Run();
+
+    // Reads of a flagged page stay on the fast path, writes to it go through the callbacks.
+    REQUIRE(jit.Regs()[1] == 0x01234567);
+    REQUIRE(watched_page[1] == 0x89abcdef);
+    REQUIRE(test_env.modified_memory.size() == 4);
+    REQUIRE(test_env.MemoryRead32(0x10004) == 0xfedcba98);
+    REQUIRE(jit.Regs()[3] == 0x89abcdef);
+    REQUIRE(page[0] == 0xfedcba98);
+}
+
+TEST_CASE("arm: Page table exclusive store under register pressure", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::UserConfig config = GetUserConfig(&test_env);
+
+    std::array<u32, 1024> page{};
+    auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    page_table->fill(nullptr);
+    (*page_table)[1] = reinterpret_cast<u8*>(page.data());
+    config.page_table = page_table.get();
+
+    A32::Jit jit{config};
+    test_env.code_mem = {
+        0xe1923f9f, // ldrex r3, [r2]
+        0xe898000f, // ldm r8, {r0-r3}
+        0xe182cf91, // strex r12, r1, [r2]
+        0xe182bf90, // strex r11, r0, [r2]
+        0xe0800001, // add r0, r0, r1
+        0xe0800002, // add r0, r0, r2
+        0xe0800003, // add r0, r0, r3
+        0xeafffffe, // b +#0 (infinite loop)
+    };
+
+    page[4] = 0x10;
+    page[5] = 0x20;
+    page[6] = 0x1000;
+    page[7] = 0x30;
+
+    jit.Regs() = {};
+    jit.Regs()[2] = 0x1000;
+    jit.Regs()[8] = 0x1010;
+    jit.Regs()[11] = 0xdeadbeef;
+    jit.Regs()[12] = 0xdeadbeef;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 7;
+    jit.Run();
+
+    // The first store holds the reservation, the second one finds it cleared.
+    REQUIRE(jit.Regs()[12] == 0);
+    REQUIRE(jit.Regs()[11] == 1);
+    REQUIRE(page[0] == 0x20);
+    REQUIRE(jit.Regs()[0] == 0x1060);
+    REQUIRE(jit.Regs()[1] == 0x20);
+    REQUIRE(jit.Regs()[2] == 0x1000);
+    REQUIRE(jit.Regs()[3] == 0x30);
+}
+
+TEST_CASE("arm: Code page reads", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::UserConfig config = GetUserConfig(&test_env);
+
+    std::array<u32, 1024> code_page{};
+    code_page[1022] = 0xe3a00001; // mov r0, #1
+    code_page[1023] = 0xe3a01002; // mov r1, #2
+    test_env.code_pages[0x20000] = reinterpret_cast<const u8*>(code_page.data());
+
+    // The following page is only available through MemoryReadCode.
+    test_env.code_mem.resize(0x21000 / 4 + 1, 0xeafffffe);
+    test_env.code_mem[0x21000 / 4] = 0xe3a02003; // mov r2, #3
+
+    A32::Jit jit{config};
+    jit.Regs() = {};
+    jit.Regs()[15] = 0x20ff8;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 1);
+    REQUIRE(jit.Regs()[1] == 2);
+    REQUIRE(jit.Regs()[2] == 3);
+    REQUIRE(jit.Regs()[15] == 0x21004);
+}
@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+
 #include <catch.hpp>
 
 #include <dynarmic/A32/a32.h>
@@ -157,3 +159,28 @@ TEST_CASE("thumb: bl -#42", "[thumb]") {
     REQUIRE(jit.Regs()[15] == 0xFFFFFFD6);
     REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
 }
+
+TEST_CASE("thumb: Code page reads", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+
+    std::array<u16, 2048> code_page{};
+    code_page[2046] = 0x2001; // movs r0, #1
+    code_page[2047] = 0xF000; // bl +#4 (first half)
+    test_env.code_pages[0x20000] = reinterpret_cast<const u8*>(code_page.data());
+
+    // The second half of bl lies on the following page, which is only available through
+    // MemoryReadCode.
+    test_env.code_mem.resize(0x21008 / 2, 0xE7FE);
+    test_env.code_mem[0x21000 / 2] = 0xF802; // bl +#4 (second half)
+
+    jit.Regs()[15] = 0x20ffc;
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 1);
+    REQUIRE(jit.Regs()[14] == (0x21002 | 1));
+    REQUIRE(jit.Regs()[15] == 0x21006);
+}
@@ -26,6 +26,7 @@ public:
     u64 ticks_left = 0;
     bool code_mem_modified_by_guest = false;
     std::vector<InstructionType> code_mem;
+    std::map<u32, const u8*> code_pages;
     std::map<u32, u8> modified_memory;
     std::vector<std::string> interrupts;
 
@@ -39,6 +40,13 @@ public:
         return infinite_loop; // B .
     }
 
+    const std::uint8_t* MemoryReadCodePage(u32 vaddr) override {
+        if (auto iter = code_pages.find(vaddr); iter != code_pages.end()) {
+            return iter->second;
+        }
+        return nullptr;
+    }
+
     std::uint8_t MemoryRead8(u32 vaddr) override {
         if (vaddr < sizeof(InstructionType) * code_mem.size()) {
             return reinterpret_cast<u8*>(code_mem.data())[vaddr];
@@ -110,6 +110,51 @@ TEST_CASE("A64: AND", "[a64]") {
     REQUIRE(jit.GetPC() == 4);
 }
 
+TEST_CASE("A64: BIC", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x8a220020); // BIC X0, X1, X2
+    env.code_mem.emplace_back(0x0a220023); // BIC W3, W1, W2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(0, 0);
+    jit.SetRegister(1, 0xffff0000ffff00ff);
+    jit.SetRegister(2, 0x0ff00ff00ff00ff0);
+    jit.SetPC(0);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0xf00f0000f00f000f);
+    REQUIRE(jit.GetRegister(3) == 0xf00f000f);
+    REQUIRE(jit.GetPC() == 8);
+}
+
+TEST_CASE("A64: ADD (shifted register)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x8b020820); // ADD X0, X1, X2, LSL #2
+    env.code_mem.emplace_back(0x8b021c23); // ADD X3, X1, X2, LSL #7
+    env.code_mem.emplace_back(0x0b020c24); // ADD W4, W1, W2, LSL #3
+    env.code_mem.emplace_back(0x0b027c25); // ADD W5, W1, W2, LSL #31
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x8000000000000001);
+    jit.SetRegister(2, 0x00000000c0000003);
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x800000030000000d);
+    REQUIRE(jit.GetRegister(3) == 0x8000006000000181);
+    REQUIRE(jit.GetRegister(4) == 0x00000019);
+    REQUIRE(jit.GetRegister(5) == 0x80000001);
+    REQUIRE(jit.GetPC() == 16);
+}
+
 TEST_CASE("A64: Bitmasks", "[a64]") {
     A64TestEnv env;
     Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
@@ -634,3 +679,393 @@ TEST_CASE("A64: Optimization failure when folding ADD", "[a64]") {
     REQUIRE(jit.GetPstate() == 0x20000000);
     REQUIRE(jit.GetVector(30) == Vector{0xf7f6f5f4, 0});
 }
+
+TEST_CASE("A64: Optimization pipeline statistics", "[a64]") {
+    A64TestEnv env;
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.optimization_passes = {
+        Dynarmic::OptimizationPass::GetSetElimination,
+        Dynarmic::OptimizationPass::ConstantMemoryReads,
+        Dynarmic::OptimizationPass::DeadCodeElimination,
+    };
+    conf.record_pass_statistics = true;
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0x8b020020); // ADD X0, X1, X2
+    env.code_mem.emplace_back(0x8b020020); // ADD X0, X1, X2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 1);
+    jit.SetRegister(2, 2);
+    jit.SetPC(0);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 3);
+
+    const auto stats = jit.GetPassStatistics();
+    REQUIRE(stats.size() == 3);
+    REQUIRE(stats[0].pass == Dynarmic::OptimizationPass::GetSetElimination);
+    REQUIRE(stats[1].pass == Dynarmic::OptimizationPass::ConstantMemoryReads);
+    REQUIRE(stats[2].pass == Dynarmic::OptimizationPass::DeadCodeElimination);
+    REQUIRE(std::string{stats[2].name} == "DeadCodeElimination");
+    REQUIRE(stats[0].invocations == 1);
+    REQUIRE(stats[2].invocations == 1);
+    REQUIRE(stats[0].instructions_after == stats[1].instructions_before);
+    REQUIRE(stats[1].instructions_after == stats[2].instructions_before);
+    REQUIRE(stats[2].instructions_after < stats[0].instructions_before);
+
+    jit.ResetPassStatistics();
+    REQUIRE(jit.GetPassStatistics()[0].invocations == 0);
+}
+
+TEST_CASE("A64: Multi-level page table", "[a64]") {
+    A64TestEnv env;
+
+    // 48-bit address space split 12/12/12 over three levels.
+    std::vector<void*> level0(4096), level1(4096), level2(4096);
+    std::array<u64, 512> page{};
+    level0[0x7ff] = level1.data();
+    level1[0xfff] = level2.data();
+    level2[0xfff] = page.data();
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.page_table = level0.data();
+    conf.page_table_address_space_bits = 48;
+    conf.page_table_levels = 3;
+    conf.silently_mirror_page_table = false;
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9400001); // LDR X1, [X0]
+    env.code_mem.emplace_back(0xf9000402); // STR X2, [X0, #8]
+    env.code_mem.emplace_back(0xf9400083); // LDR X3, [X4]
+    env.code_mem.emplace_back(0xf94000c5); // LDR X5, [X6]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    page[0] = 0x0123456789abcdef;
+    jit.SetRegister(0, 0x00007ffffffff000);
+    jit.SetRegister(2, 0xfedcba9876543210);
+    jit.SetRegister(4, 0x00007fffffffe000); // Unmapped leaf entry
+    jit.SetRegister(6, 0x00017ffffffff000); // Outside of address space
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+    REQUIRE(page[1] == 0xfedcba9876543210);
+    REQUIRE(jit.GetRegister(3) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(5) == 0x0706050403020100);
+    REQUIRE(env.modified_memory.empty());
+    REQUIRE(jit.GetPC() == 16);
+}
+
+TEST_CASE("A64: Software TLB", "[a64]") {
+    A64TestEnv env;
+    std::array<u64, 512> page{}, other_page{};
+    env.translated_pages[0x10000] = reinterpret_cast<u8*>(page.data());
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.enable_software_tlb = true;
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9400001); // LDR X1, [X0]
+    env.code_mem.emplace_back(0xf9000402); // STR X2, [X0, #8]
+    env.code_mem.emplace_back(0xf94000c5); // LDR X5, [X6]
+    env.code_mem.emplace_back(0xf9400107); // LDR X7, [X8]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    page[0] = 0x0123456789abcdef;
+    other_page[0] = 0x1122334455667788;
+    jit.SetRegister(0, 0x10000);
+    jit.SetRegister(2, 0xfedcba9876543210);
+    jit.SetRegister(6, 0x20000); // Not translated
+    jit.SetRegister(8, 0x10ffc); // Straddles a page boundary
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+    REQUIRE(page[1] == 0xfedcba9876543210);
+    REQUIRE(jit.GetRegister(5) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(7) == 0x03020100fffefdfc);
+    REQUIRE(env.modified_memory.empty());
+
+    // Stale translations remain in use until they are invalidated.
+    env.translated_pages[0x10000] = reinterpret_cast<u8*>(other_page.data());
+    jit.SetPC(0);
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+
+    jit.InvalidateTlbRange(0x10000, 8);
+    jit.SetPC(0);
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x1122334455667788);
+    REQUIRE(other_page[1] == 0xfedcba9876543210);
+}
+
+TEST_CASE("A64: Page table attribute bits", "[a64]") {
+    A64TestEnv env;
+
+    std::vector<void*> page_table(256);
+    std::array<u64, 512> watched_page{}, page{};
+    page_table[0x10] = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(watched_page.data()) | Dynarmic::A64::UserConfig::PAGE_ATTRIBUTE_WRITE_CALLBACK);
+    page_table[0x11] = page.data();
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+    conf.page_table_attribute_bits = true;
+    conf.enable_software_tlb = GENERATE(false, true);
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9400001); // LDR X1, [X0]
+    env.code_mem.emplace_back(0xf9000402); // STR X2, [X0, #8]
+    env.code_mem.emplace_back(0xf9400403); // LDR X3, [X0, #8]
+    env.code_mem.emplace_back(0xf9000082); // STR X2, [X4]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    watched_page[0] = 0x0123456789abcdef;
+    watched_page[1] = 0x1122334455667788;
+    jit.SetRegister(0, 0x10000);
+    jit.SetRegister(2, 0xfedcba9876543210);
+    jit.SetRegister(4, 0x11000);
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+    REQUIRE(watched_page[1] == 0x1122334455667788);
+    REQUIRE(env.modified_memory.size() == 8);
+    REQUIRE(env.MemoryRead64(0x10008) == 0xfedcba9876543210);
+    REQUIRE(jit.GetRegister(3) == 0x1122334455667788);
+    REQUIRE(page[0] == 0xfedcba9876543210);
+}
+
+TEST_CASE("A64: Memory block callbacks", "[a64]") {
+    A64TestEnv env;
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.enable_memory_block_callbacks = true;
+    conf.optimization_level = Dynarmic::OptimizationLevel::Fast; // Keeps the pairs from being coalesced
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xa9400801); // LDP X1, X2, [X0]
+    env.code_mem.emplace_back(0xa9011003); // STP X3, X4, [X0, #16]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(0, 0x1000);
+    jit.SetRegister(3, 0x0123456789abcdef);
+    jit.SetRegister(4, 0xfedcba9876543210);
+    jit.SetPC(0);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(2) == 0x0f0e0d0c0b0a0908);
+    REQUIRE(env.MemoryRead64(0x1010) == 0x0123456789abcdef);
+    REQUIRE(env.MemoryRead64(0x1018) == 0xfedcba9876543210);
+    REQUIRE(env.memory_block_reads == 1);
+    REQUIRE(env.memory_block_writes == 1);
+}
+
+TEST_CASE("A64: Memory access coalescing", "[a64]") {
+    A64TestEnv env;
+
+    std::vector<void*> page_table(256);
+    std::array<u64, 512> page{}, next_page{};
+    page_table[0x10] = page.data();
+    page_table[0x11] = next_page.data();
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+    conf.detect_misaligned_access_via_page_table = 64 | 128;
+    conf.only_detect_misalignment_via_page_table_on_page_boundary = true;
+    conf.optimization_passes = {Dynarmic::OptimizationPass::MemoryCoalescing};
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xa9400801); // LDP X1, X2, [X0]
+    env.code_mem.emplace_back(0x294010a3); // LDP W3, W4, [X5]
+    env.code_mem.emplace_back(0xa9011c06); // STP X6, X7, [X0, #16]
+    env.code_mem.emplace_back(0x29042408); // STP W8, W9, [X0, #32]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    page[0] = 0x0123456789abcdef;
+    page[1] = 0x1122334455667788;
+    page[511] = 0xfffefdfc'00000000;
+    next_page[0] = 0x03020100;
+    jit.SetRegister(0, 0x10000);
+    jit.SetRegister(5, 0x10ffc); // Straddles a page boundary once coalesced
+    jit.SetRegister(6, 0xfedcba9876543210);
+    jit.SetRegister(7, 0x8877665544332211);
+    jit.SetRegister(8, 0x89abcdef);
+    jit.SetRegister(9, 0x01234567);
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+    REQUIRE(jit.GetRegister(2) == 0x1122334455667788);
+    REQUIRE(jit.GetRegister(3) == 0xfffefdfc);
+    REQUIRE(jit.GetRegister(4) == 0x03020100);
+    REQUIRE(page[2] == 0xfedcba9876543210);
+    REQUIRE(page[3] == 0x8877665544332211);
+    REQUIRE(page[4] == 0x0123456789abcdef);
+    REQUIRE(env.modified_memory.empty());
+}
+
+TEST_CASE("A64: Redundant load elimination", "[a64]") {
+    A64TestEnv env;
+
+    // The pass only runs on memory that is backed by host pages.
+    std::vector<void*> page_table(256);
+    std::array<u8, 4096> page;
+    for (size_t i = 0; i < page.size(); i++) {
+        page[i] = static_cast<u8>(i);
+    }
+    page_table[0x01] = page.data();
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+    conf.optimization_passes = {
+        Dynarmic::OptimizationPass::GetSetElimination,
+        Dynarmic::OptimizationPass::RedundantLoadElimination,
+    };
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9000001); // STR X1, [X0]
+    env.code_mem.emplace_back(0xb90000a2); // STR W2, [X5]
+    env.code_mem.emplace_back(0xf9400003); // LDR X3, [X0]
+    env.code_mem.emplace_back(0xf9000401); // STR X1, [X0, #8]
+    env.code_mem.emplace_back(0x39002402); // STRB W2, [X0, #9]
+    env.code_mem.emplace_back(0xf9400404); // LDR X4, [X0, #8]
+    env.code_mem.emplace_back(0xf9400806); // LDR X6, [X0, #16]
+    env.code_mem.emplace_back(0xf9400807); // LDR X7, [X0, #16]
+    env.code_mem.emplace_back(0xf9000c01); // STR X1, [X0, #24]
+    env.code_mem.emplace_back(0xf9400c08); // LDR X8, [X0, #24]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(0, 0x1000);
+    jit.SetRegister(1, 0x0123456789abcdef);
+    jit.SetRegister(2, 0xfedcba98);
+    jit.SetRegister(5, 0x1004); // Aliases [X0, #4]
+    jit.SetPC(0);
+
+    env.ticks_left = 11;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(3) == 0xfedcba9889abcdef);
+    REQUIRE(jit.GetRegister(4) == 0x0123456789ab98ef);
+    REQUIRE(jit.GetRegister(6) == 0x1716151413121110);
+    REQUIRE(jit.GetRegister(7) == 0x1716151413121110);
+    REQUIRE(jit.GetRegister(8) == 0x0123456789abcdef);
+}
+
+TEST_CASE("A64: Redundant load elimination keeps callback reads", "[a64]") {
+    A64TestEnv env;
+
+    // Without a page table every read may be memory-mapped I/O, so neither read can be removed.
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.optimization_passes = {
+        Dynarmic::OptimizationPass::GetSetElimination,
+        Dynarmic::OptimizationPass::RedundantLoadElimination,
+    };
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9400001); // LDR X1, [X0]
+    env.code_mem.emplace_back(0xf9400002); // LDR X2, [X0]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(0, 0x1000);
+    jit.SetPC(0);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(env.memory_reads_64 == 2);
+    REQUIRE(jit.GetRegister(1) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(2) == 0x0706050403020100);
+}
+
+TEST_CASE("A64: Constant memory reads", "[a64]") {
+    A64TestEnv env;
+    env.code_mem_is_read_only = true;
+
+    Dynarmic::A64::UserConfig conf{&env};
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0x58000101); // LDR X1, #32
+    env.code_mem.emplace_back(0x9c000122); // LDR Q2, #36
+    env.code_mem.emplace_back(0x90000003); // ADRP X3, #0
+    env.code_mem.emplace_back(0xf9401064); // LDR X4, [X3, #32]
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0xd503201f); // NOP
+    env.code_mem.emplace_back(0xd503201f); // NOP
+    env.code_mem.emplace_back(0xd503201f); // NOP
+    env.code_mem.emplace_back(0x89abcdef); // Literal pool
+    env.code_mem.emplace_back(0x01234567);
+    env.code_mem.emplace_back(0x33221100);
+    env.code_mem.emplace_back(0x77665544);
+    env.code_mem.emplace_back(0xbbaa9988);
+    env.code_mem.emplace_back(0xffeeddcc);
+
+    jit.SetPC(0);
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+    REQUIRE(jit.GetVector(2) == Vector{0x7766554433221100, 0xffeeddccbbaa9988});
+    REQUIRE(jit.GetRegister(4) == 0x0123456789abcdef);
+
+    // Reads from read-only memory have been folded into the compiled code.
+    env.code_mem[8] = 0;
+    env.code_mem[10] = 0;
+    jit.SetRegister(1, 0);
+    jit.SetRegister(4, 0);
+    jit.SetVector(2, {0, 0});
+    jit.SetPC(0);
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x0123456789abcdef);
+    REQUIRE(jit.GetVector(2) == Vector{0x7766554433221100, 0xffeeddccbbaa9988});
+    REQUIRE(jit.GetRegister(4) == 0x0123456789abcdef);
+}
+
+TEST_CASE("A64: Code page reads", "[a64]") {
+    A64TestEnv env;
+
+    std::array<u32, 1024> code_page{};
+    code_page[1022] = 0xd2800020; // MOVZ X0, #1
+    code_page[1023] = 0xd2800041; // MOVZ X1, #2
+    env.code_pages[0x20000] = reinterpret_cast<const u8*>(code_page.data());
+
+    // The following page is only available through MemoryReadCode.
+    env.code_mem_start_address = 0x21000;
+    env.code_mem.emplace_back(0xd2800062); // MOVZ X2, #3
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    Dynarmic::A64::UserConfig conf{&env};
+    Dynarmic::A64::Jit jit{conf};
+
+    jit.SetPC(0x20ff8);
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 1);
+    REQUIRE(jit.GetRegister(1) == 2);
+    REQUIRE(jit.GetRegister(2) == 3);
+    REQUIRE(jit.GetPC() == 0x21004);
+}
@@ -20,10 +20,16 @@ public:
     u64 ticks_left = 0;
 
     bool code_mem_modified_by_guest = false;
+    bool code_mem_is_read_only = false;
     u64 code_mem_start_address = 0;
     std::vector<u32> code_mem;
+    std::map<u64, const u8*> code_pages;
 
     std::map<u64, u8> modified_memory;
+    std::map<u64, u8*> translated_pages;
+    size_t memory_block_reads = 0;
+    size_t memory_block_writes = 0;
+    size_t memory_reads_64 = 0;
     std::vector<std::string> interrupts;
 
     bool IsInCodeMem(u64 vaddr) const {
@@ -39,6 +45,13 @@ public:
         return code_mem[index];
     }
 
+    const std::uint8_t* MemoryReadCodePage(u64 vaddr) override {
+        if (auto iter = code_pages.find(vaddr); iter != code_pages.end()) {
+            return iter->second;
+        }
+        return nullptr;
+    }
+
     std::uint8_t MemoryRead8(u64 vaddr) override {
         if (IsInCodeMem(vaddr)) {
             return reinterpret_cast<u8*>(code_mem.data())[vaddr - code_mem_start_address];
@@ -55,6 +68,7 @@ public:
         return u32(MemoryRead16(vaddr)) | u32(MemoryRead16(vaddr + 2)) << 16;
     }
     std::uint64_t MemoryRead64(u64 vaddr) override {
+        memory_reads_64++;
         return u64(MemoryRead32(vaddr)) | u64(MemoryRead32(vaddr + 4)) << 32;
     }
     Vector MemoryRead128(u64 vaddr) override {
@@ -105,6 +119,26 @@ public:
         return true;
     }
 
+    void MemoryReadBlock(u64 vaddr, void* buffer, std::size_t length) override {
+        memory_block_reads++;
+        UserCallbacks::MemoryReadBlock(vaddr, buffer, length);
+    }
+    void MemoryWriteBlock(u64 vaddr, const void* buffer, std::size_t length) override {
+        memory_block_writes++;
+        UserCallbacks::MemoryWriteBlock(vaddr, buffer, length);
+    }
+
+    bool IsReadOnlyMemory(u64 vaddr) override {
+        return code_mem_is_read_only && IsInCodeMem(vaddr);
+    }
+
+    std::uint8_t* TranslateAddress(u64 vaddr) override {
+        if (auto iter = translated_pages.find(vaddr); iter != translated_pages.end()) {
+            return iter->second;
+        }
+        return nullptr;
+    }
+
     void InterpreterFallback(u64 pc, size_t num_instructions) override { ASSERT_MSG(false, "InterpreterFallback({:016x}, {})", pc, num_instructions); }
 
     void CallSVC(std::uint32_t swi) override { ASSERT_MSG(false, "CallSVC({})", swi); }
@@ -0,0 +1,118 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <utility>
+#include <vector>
+
+#include <catch.hpp>
+
+#include "common/common_types.h"
+#include "common/memory_pool.h"
+#include "frontend/A32/ir_emitter.h"
+#include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+A32::LocationDescriptor TestLocation(u32 pc) {
+    return A32::LocationDescriptor{pc, A32::PSR{0x000001d0}, A32::FPSCR{}};
+}
+
+// Emits a chain of count dependent additions and returns the final value.
+IR::U32 EmitAddChain(A32::IREmitter& ir, size_t count) {
+    IR::U32 value = ir.GetRegister(A32::Reg::R0);
+    for (size_t i = 0; i < count; i++) {
+        value = ir.Add(value, ir.Imm32(static_cast<u32>(i)));
+    }
+    return value;
+}
+
+// Checks that the block contains exactly the chain emitted by EmitAddChain followed by a SetRegister.
+void CheckAddChain(const IR::Block& block, size_t count) {
+    REQUIRE(block.size() == count + 2);
+
+    auto iter = block.begin();
+    REQUIRE(iter->GetOpcode() == IR::Opcode::A32GetRegister);
+    const IR::Inst* previous = &*iter;
+    ++iter;
+
+    for (size_t i = 0; i < count; i++, ++iter) {
+        REQUIRE(iter->GetOpcode() == IR::Opcode::Add32);
+        REQUIRE(iter->GetArg(0).GetInst() == previous);
+        REQUIRE(iter->GetArg(1).GetU32() == static_cast<u32>(i));
+        REQUIRE(iter->UseCount() == 1);
+        previous = &*iter;
+    }
+
+    REQUIRE(iter->GetOpcode() == IR::Opcode::A32SetRegister);
+    REQUIRE(iter->GetArg(1).GetInst() == previous);
+}
+
+} // anonymous namespace
+
+TEST_CASE("Pool: Reset reuses existing slabs", "[ir]") {
+    Common::Pool pool{sizeof(u64), 4};
+
+    std::vector<void*> first_pass;
+    for (size_t i = 0; i < 10; i++) {
+        first_pass.push_back(pool.Alloc());
+    }
+
+    pool.Reset();
+
+    for (size_t i = 0; i < 10; i++) {
+        REQUIRE(pool.Alloc() == first_pass[i]);
+    }
+}
+
+TEST_CASE("Block: Instructions of recycled pools are independent", "[ir]") {
+    // Larger than a single pool slab, so that recycled pools have more than one slab to rewind.
+    constexpr size_t chain_length = 5000;
+
+    for (int round = 0; round < 3; round++) {
+        IR::Block block{TestLocation(0)};
+        A32::IREmitter ir{block, TestLocation(0)};
+        ir.SetRegister(A32::Reg::R1, EmitAddChain(ir, chain_length));
+        CheckAddChain(block, chain_length);
+    }
+}
+
+TEST_CASE("Block: Blocks with overlapping lifetimes do not share instructions", "[ir]") {
+    IR::Block outer{TestLocation(0)};
+    A32::IREmitter outer_ir{outer, TestLocation(0)};
+    outer_ir.SetRegister(A32::Reg::R1, EmitAddChain(outer_ir, 100));
+
+    for (int round = 0; round < 8; round++) {
+        IR::Block inner{TestLocation(4)};
+        A32::IREmitter inner_ir{inner, TestLocation(4)};
+        inner_ir.SetRegister(A32::Reg::R1, EmitAddChain(inner_ir, 200));
+        CheckAddChain(inner, 200);
+    }
+
+    CheckAddChain(outer, 100);
+}
+
+TEST_CASE("Block: Moved-from blocks release their pool safely", "[ir]") {
+    IR::Block destination{TestLocation(0)};
+    {
+        IR::Block source{TestLocation(4)};
+        A32::IREmitter ir{source, TestLocation(4)};
+        ir.SetRegister(A32::Reg::R1, EmitAddChain(ir, 50));
+        destination = std::move(source);
+    }
+
+    // A block created after the move must not be handed the pool backing destination's instructions.
+    IR::Block other{TestLocation(8)};
+    A32::IREmitter other_ir{other, TestLocation(8)};
+    other_ir.SetRegister(A32::Reg::R1, EmitAddChain(other_ir, 50));
+
+    CheckAddChain(destination, 50);
+    CheckAddChain(other, 50);
+}
@@ -0,0 +1,82 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <catch.hpp>
+
+#include <dynarmic/A32/config.h>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "frontend/A32/ir_emitter.h"
+#include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "ir_opt/passes.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+const A32::LocationDescriptor test_location{0, A32::PSR{0x000001d0}, A32::FPSCR{}};
+
+/// Memory below 0x1000 is read-only, and each byte holds the low bits of its address.
+class ReadOnlyMemoryEnv final : public A32::UserCallbacks {
+public:
+    std::uint8_t MemoryRead8(u32 vaddr) override { return static_cast<u8>(vaddr); }
+    std::uint16_t MemoryRead16(u32 vaddr) override { return u16(MemoryRead8(vaddr)) | u16(MemoryRead8(vaddr + 1)) << 8; }
+    std::uint32_t MemoryRead32(u32 vaddr) override { return u32(MemoryRead16(vaddr)) | u32(MemoryRead16(vaddr + 2)) << 16; }
+    std::uint64_t MemoryRead64(u32 vaddr) override { return u64(MemoryRead32(vaddr)) | u64(MemoryRead32(vaddr + 4)) << 32; }
+
+    void MemoryWrite8(u32, std::uint8_t) override { ASSERT_FALSE("MemoryWrite8()"); }
+    void MemoryWrite16(u32, std::uint16_t) override { ASSERT_FALSE("MemoryWrite16()"); }
+    void MemoryWrite32(u32, std::uint32_t) override { ASSERT_FALSE("MemoryWrite32()"); }
+    void MemoryWrite64(u32, std::uint64_t) override { ASSERT_FALSE("MemoryWrite64()"); }
+
+    bool IsReadOnlyMemory(u32 vaddr) override { return vaddr < 0x1000; }
+
+    void InterpreterFallback(u32, size_t) override { ASSERT_FALSE("InterpreterFallback()"); }
+    void CallSVC(std::uint32_t) override { ASSERT_FALSE("CallSVC()"); }
+    void ExceptionRaised(u32, A32::Exception) override { ASSERT_FALSE("ExceptionRaised()"); }
+    void AddTicks(std::uint64_t) override {}
+    std::uint64_t GetTicksRemaining() override { return 0; }
+};
+
+} // anonymous namespace
+
+TEST_CASE("A32ConstantMemoryReads: Folds 128-bit reads of read-only memory", "[ir_opt]") {
+    ReadOnlyMemoryEnv env;
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    block.AppendNewInst(IR::Opcode::A32ReadMemory128, {ir.Imm32(0x100)});
+    const IR::U128 value{&block.back()};
+    ir.SetExtendedRegister(A32::ExtReg::D0, IR::U64{ir.VectorGetElement(64, value, 0)});
+
+    Optimization::A32ConstantMemoryReads(block, &env);
+
+    const IR::Inst* const element = block.back().GetArg(1).GetInst();
+    const IR::Inst* const pack = element->GetArg(0).GetInstRecursive();
+    REQUIRE(pack->GetOpcode() == IR::Opcode::Pack2x64To1x128);
+    REQUIRE(pack->GetArg(0).GetU64() == 0x0706050403020100);
+    REQUIRE(pack->GetArg(1).GetU64() == 0x0F0E0D0C0B0A0908);
+}
+
+TEST_CASE("A32ConstantMemoryReads: Keeps 128-bit reads that reach writable memory", "[ir_opt]") {
+    ReadOnlyMemoryEnv env;
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    // The upper half of this access lies outside of read-only memory.
+    block.AppendNewInst(IR::Opcode::A32ReadMemory128, {ir.Imm32(0xFF8)});
+    const IR::U128 value{&block.back()};
+    ir.SetExtendedRegister(A32::ExtReg::D0, IR::U64{ir.VectorGetElement(64, value, 0)});
+
+    Optimization::A32ConstantMemoryReads(block, &env);
+
+    const IR::Inst* const element = block.back().GetArg(1).GetInst();
+    REQUIRE(element->GetArg(0).GetInst()->GetOpcode() == IR::Opcode::A32ReadMemory128);
+}
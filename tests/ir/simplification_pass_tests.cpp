@@ -0,0 +1,111 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <catch.hpp>
+
+#include "common/common_types.h"
+#include "frontend/A32/ir_emitter.h"
+#include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "ir_opt/passes.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+const A32::LocationDescriptor test_location{0, A32::PSR{0x000001d0}, A32::FPSCR{}};
+
+} // anonymous namespace
+
+TEST_CASE("SimplificationPass: Folds constant arithmetic", "[ir_opt]") {
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    const IR::U32 sum = ir.Add(ir.Imm32(2), ir.Imm32(3));
+    ir.SetRegister(A32::Reg::R1, ir.Eor(sum, ir.Imm32(0xFF)));
+
+    Optimization::SimplificationPass(block);
+
+    REQUIRE(block.size() == 1);
+    REQUIRE(block.front().GetOpcode() == IR::Opcode::A32SetRegister);
+    REQUIRE(block.front().GetArg(1).IsImmediate());
+    REQUIRE(block.front().GetArg(1).GetU32() == 0xFA);
+}
+
+TEST_CASE("SimplificationPass: Unused pseudo-operations do not inhibit folding", "[ir_opt]") {
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    const auto result = ir.AddWithCarry(ir.Imm32(1), ir.Imm32(2), ir.Imm1(true));
+    ir.SetRegister(A32::Reg::R1, result.result);
+
+    Optimization::SimplificationPass(block);
+
+    REQUIRE(block.size() == 1);
+    REQUIRE(block.front().GetOpcode() == IR::Opcode::A32SetRegister);
+    REQUIRE(block.front().GetArg(1).IsImmediate());
+    REQUIRE(block.front().GetArg(1).GetU32() == 4);
+}
+
+TEST_CASE("SimplificationPass: Removes dead instructions", "[ir_opt]") {
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    // The whole chain feeding the unused value is dead, not just its last instruction.
+    const IR::U32 r0 = ir.GetRegister(A32::Reg::R0);
+    const IR::U32 unused = ir.Add(ir.LogicalShiftLeft(r0, ir.Imm8(4)), r0);
+    (void)unused;
+    ir.SetRegister(A32::Reg::R1, ir.GetRegister(A32::Reg::R2));
+
+    Optimization::SimplificationPass(block);
+
+    REQUIRE(block.size() == 2);
+    auto iter = block.begin();
+    REQUIRE(iter->GetOpcode() == IR::Opcode::A32GetRegister);
+    REQUIRE(iter->GetArg(0).GetA32RegRef() == A32::Reg::R2);
+    const IR::Inst* const get_r2 = &*iter;
+    ++iter;
+    REQUIRE(iter->GetOpcode() == IR::Opcode::A32SetRegister);
+    REQUIRE(iter->GetArg(1).GetInst() == get_r2);
+}
+
+TEST_CASE("SimplificationPass: Keeps instructions with side-effects", "[ir_opt]") {
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    ir.WriteMemory32(ir.Imm32(0x100), ir.Imm32(1));
+    ir.SetRegister(A32::Reg::R1, ir.Imm32(2));
+
+    Optimization::SimplificationPass(block);
+
+    REQUIRE(block.size() == 2);
+    REQUIRE(block.front().GetOpcode() == IR::Opcode::A32WriteMemory32);
+    REQUIRE(block.back().GetOpcode() == IR::Opcode::A32SetRegister);
+}
+
+TEST_CASE("SimplificationPass: Forwards identities to their users", "[ir_opt]") {
+    IR::Block block{test_location};
+    A32::IREmitter ir{block, test_location};
+
+    const IR::U32 r0 = ir.GetRegister(A32::Reg::R0);
+    block.AppendNewInst(IR::Opcode::Identity, {r0});
+    const IR::U32 identity{&block.back()};
+    ir.SetRegister(A32::Reg::R1, ir.Eor(identity, ir.Imm32(1)));
+
+    Optimization::SimplificationPass(block);
+
+    REQUIRE(block.size() == 3);
+    auto iter = block.begin();
+    REQUIRE(iter->GetOpcode() == IR::Opcode::A32GetRegister);
+    const IR::Inst* const get_r0 = &*iter;
+    ++iter;
+    REQUIRE(iter->GetOpcode() == IR::Opcode::Eor32);
+    REQUIRE(iter->GetArg(0).GetInst() == get_r0);
+    ++iter;
+    REQUIRE(iter->GetOpcode() == IR::Opcode::A32SetRegister);
+}